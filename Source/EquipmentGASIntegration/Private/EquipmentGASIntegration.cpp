@@ -1,53 +1,86 @@
 #include "EquipmentGASIntegration.h"
 #include "Components/EquipmentManagerComponent.h"
-#include "EquipmentAbilityGranter.h"
-#include "EquipmentEffectApplier.h"
+#include "EquipmentGASSubsystem.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
 
 #define LOCTEXT_NAMESPACE "FEquipmentGASIntegrationModule"
 
 void FEquipmentGASIntegrationModule::StartupModule()
 {
-	// Register the GAS setup factory so EquipmentManagerComponent can create GAS handlers
+	// Register the GAS setup factory so EquipmentManagerComponent routes GAS work to the world's handler
 	UEquipmentManagerComponent::GASSetupFactory = [](UEquipmentManagerComponent* Manager)
 	{
-		UEquipmentAbilityGranter* Granter = NewObject<UEquipmentAbilityGranter>(Manager);
-		UEquipmentEffectApplier* Applier = NewObject<UEquipmentEffectApplier>(Manager);
+		// Server-only — clients never grant or apply, so they need no record
+		if (Manager->GetOwner() && !Manager->GetOwner()->HasAuthority())
+		{
+			return;
+		}
+
+		UEquipmentGASSubsystem* Subsystem = Manager->GetWorld() ? Manager->GetWorld()->GetSubsystem<UEquipmentGASSubsystem>() : nullptr;
+		if (!Subsystem)
+		{
+			return;
+		}
 
-		// Store as UObject to prevent GC (core module doesn't know concrete types)
-		Manager->GASAbilityGranter = Granter;
-		Manager->GASEffectApplier = Applier;
+		// Optional single aggregated stats effect — one small asset, loaded once per manager
+		const int32 ManagerId = Subsystem->RegisterManager(Manager,
+			Manager->AggregatedStatsEffect.TryLoadClass<UGameplayEffect>());
+
+		// The component holds no GAS objects — callbacks address the subsystem's records by id
+		TWeakObjectPtr<UEquipmentGASSubsystem> WeakSubsystem = Subsystem;
 
 		// Bind equip callback
-		Manager->OnGASEquipCallback = [Granter, Applier, Manager](const FItemInstance& Item, FGameplayTag SlotTag)
+		Manager->OnGASEquipCallback = [WeakSubsystem, Manager, ManagerId](const FItemInstance& Item, FGameplayTag SlotTag,
+			const UItemFragment_Equipment* EquipFrag)
 		{
-			UAbilitySystemComponent* ASC = Manager->GetOwner()
-				? Manager->GetOwner()->FindComponentByClass<UAbilitySystemComponent>()
-				: nullptr;
-
-			if (!ASC)
+			if (UEquipmentGASSubsystem* GAS = WeakSubsystem.Get())
 			{
-				return;
+				GAS->Equip(ManagerId, Manager->GetSlotIndex(SlotTag), Item, EquipFrag, Cast<UAbilitySystemComponent>(
+					Manager->GetAbilitySystemBinding(UAbilitySystemComponent::StaticClass())));
 			}
-
-			Granter->GrantAbilities(Item, SlotTag, ASC);
-			Applier->ApplyEffects(Item, SlotTag, ASC);
 		};
 
 		// Bind unequip callback
-		Manager->OnGASUnequipCallback = [Granter, Applier, Manager](FGameplayTag SlotTag)
+		Manager->OnGASUnequipCallback = [WeakSubsystem, Manager, ManagerId](FGameplayTag SlotTag)
 		{
-			UAbilitySystemComponent* ASC = Manager->GetOwner()
-				? Manager->GetOwner()->FindComponentByClass<UAbilitySystemComponent>()
-				: nullptr;
+			if (UEquipmentGASSubsystem* GAS = WeakSubsystem.Get())
+			{
+				GAS->Unequip(ManagerId, Manager->GetSlotIndex(SlotTag), Cast<UAbilitySystemComponent>(
+					Manager->GetAbilitySystemBinding(UAbilitySystemComponent::StaticClass())));
+			}
+		};
 
-			if (!ASC)
+		// Swap callback — diff ability grants so abilities shared by both items survive
+		Manager->OnGASSwapCallback = [WeakSubsystem, Manager, ManagerId](const FItemInstance& Item, FGameplayTag SlotTag,
+			const UItemFragment_Equipment* EquipFrag)
+		{
+			if (UEquipmentGASSubsystem* GAS = WeakSubsystem.Get())
 			{
-				return;
+				GAS->Swap(ManagerId, Manager->GetSlotIndex(SlotTag), Item, EquipFrag, Cast<UAbilitySystemComponent>(
+					Manager->GetAbilitySystemBinding(UAbilitySystemComponent::StaticClass())));
 			}
+		};
 
-			Granter->RevokeAbilities(SlotTag, ASC);
-			Applier->RemoveEffects(SlotTag, ASC);
+		// Commit callback — push folded stats once per change or batch
+		Manager->OnGASCommitCallback = [WeakSubsystem, Manager, ManagerId]()
+		{
+			if (UEquipmentGASSubsystem* GAS = WeakSubsystem.Get())
+			{
+				GAS->CommitAggregatedStats(ManagerId, Cast<UAbilitySystemComponent>(
+					Manager->GetAbilitySystemBinding(UAbilitySystemComponent::StaticClass())));
+			}
+		};
+
+		// Release callback — take back grants and free the records when the component ends play
+		Manager->OnGASReleaseCallback = [WeakSubsystem, Manager, ManagerId]()
+		{
+			if (UEquipmentGASSubsystem* GAS = WeakSubsystem.Get())
+			{
+				GAS->UnregisterManager(ManagerId, Cast<UAbilitySystemComponent>(
+					Manager->GetAbilitySystemBinding(UAbilitySystemComponent::StaticClass())));
+			}
 		};
 	};
 }
@@ -0,0 +1,559 @@
+#include "EquipmentGASSubsystem.h"
+#include "Components/EquipmentManagerComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectComponent.h"
+#include "Types/CGFItemTypes.h"
+#include "Data/ItemDefinition.h"
+#include "Data/Fragments/ItemFragment_Equipment.h"
+#include "Subsystems/ItemDatabaseSubsystem.h"
+
+void UEquipmentGASSubsystem::Deinitialize()
+{
+	Managers.Reset();
+	FreeManagerIds.Reset();
+	SlotRecords.Reset();
+	FreeSlotBlocks.Reset();
+	StatChannelsByEffect.Reset();
+	AggregatedStatsEffects.Reset();
+
+	Super::Deinitialize();
+}
+
+// ===========================================================================
+// Registration
+// ===========================================================================
+
+int32 UEquipmentGASSubsystem::RegisterManager(UEquipmentManagerComponent* Manager,
+	TSubclassOf<UGameplayEffect> AggregatedStatsEffect)
+{
+	if (!Manager)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 SlotCount = Manager->AvailableSlots.Num();
+
+	int32 ManagerId;
+	if (FreeManagerIds.Num() > 0)
+	{
+		ManagerId = FreeManagerIds.Pop();
+	}
+	else
+	{
+		ManagerId = Managers.AddDefaulted();
+	}
+
+	FManagerRecord& Record = Managers[ManagerId];
+	Record = FManagerRecord();
+	Record.Manager = Manager;
+	Record.SlotCount = SlotCount;
+
+	// Reuse the first released block that fits, otherwise grow the flat slot array
+	const int32 BlockIndex = FreeSlotBlocks.IndexOfByPredicate([SlotCount](const FSlotBlock& Block)
+	{
+		return Block.SlotCount >= SlotCount;
+	});
+
+	if (BlockIndex != INDEX_NONE)
+	{
+		FSlotBlock& Block = FreeSlotBlocks[BlockIndex];
+		Record.FirstSlot = Block.FirstSlot;
+		Block.FirstSlot += SlotCount;
+		Block.SlotCount -= SlotCount;
+		if (Block.SlotCount == 0)
+		{
+			FreeSlotBlocks.RemoveAtSwap(BlockIndex);
+		}
+	}
+	else
+	{
+		Record.FirstSlot = SlotRecords.AddDefaulted(SlotCount);
+	}
+
+	if (AggregatedStatsEffect && GetStatChannels(AggregatedStatsEffect).Num() > 0)
+	{
+		Record.AggregatedStatsEffect = AggregatedStatsEffect;
+	}
+
+	return ManagerId;
+}
+
+void UEquipmentGASSubsystem::UnregisterManager(int32 ManagerId, UAbilitySystemComponent* ASC)
+{
+	FManagerRecord* Record = FindManager(ManagerId);
+	if (!Record)
+	{
+		return;
+	}
+
+	// The ASC may outlive the manager (e.g. on a player state) — take back everything granted, as RemoveGAS would
+	for (int32 Index = Record->FirstSlot; Index < Record->FirstSlot + Record->SlotCount; ++Index)
+	{
+		if (ASC)
+		{
+			RevokeAbilities(SlotRecords[Index], ASC);
+			RemoveEffects(*Record, SlotRecords[Index], ASC);
+		}
+		SlotRecords[Index] = FSlotRecord();
+	}
+
+	if (ASC && Record->AggregatedStatsHandle.IsValid())
+	{
+		ASC->RemoveActiveGameplayEffect(Record->AggregatedStatsHandle);
+	}
+
+	if (Record->SlotCount > 0)
+	{
+		FreeSlotBlocks.Add({ Record->FirstSlot, Record->SlotCount });
+	}
+
+	*Record = FManagerRecord();
+	FreeManagerIds.Add(ManagerId);
+}
+
+UEquipmentGASSubsystem::FManagerRecord* UEquipmentGASSubsystem::FindManager(int32 ManagerId)
+{
+	if (!Managers.IsValidIndex(ManagerId) || !Managers[ManagerId].Manager.IsValid())
+	{
+		return nullptr;
+	}
+	return &Managers[ManagerId];
+}
+
+UEquipmentGASSubsystem::FSlotRecord* UEquipmentGASSubsystem::FindSlot(int32 ManagerId, int32 SlotIndex)
+{
+	const FManagerRecord* Record = FindManager(ManagerId);
+	if (!Record || SlotIndex < 0 || SlotIndex >= Record->SlotCount)
+	{
+		return nullptr;
+	}
+	return &SlotRecords[Record->FirstSlot + SlotIndex];
+}
+
+// ===========================================================================
+// Slot Operations
+// ===========================================================================
+
+void UEquipmentGASSubsystem::Equip(int32 ManagerId, int32 SlotIndex, const FItemInstance& Item,
+	const UItemFragment_Equipment* EquipFrag, UAbilitySystemComponent* ASC)
+{
+	FSlotRecord* Slot = FindSlot(ManagerId, SlotIndex);
+	EquipFrag = ResolveFragment(Item, EquipFrag);
+	if (!Slot || !ASC || !EquipFrag)
+	{
+		return;
+	}
+
+	FManagerRecord& Record = Managers[ManagerId];
+	GrantAbilities(Record, *Slot, EquipFrag, ASC);
+	ApplyEffects(Record, *Slot, EquipFrag, ASC);
+}
+
+void UEquipmentGASSubsystem::Unequip(int32 ManagerId, int32 SlotIndex, UAbilitySystemComponent* ASC)
+{
+	FSlotRecord* Slot = FindSlot(ManagerId, SlotIndex);
+	if (!Slot || !ASC)
+	{
+		return;
+	}
+
+	RevokeAbilities(*Slot, ASC);
+	RemoveEffects(Managers[ManagerId], *Slot, ASC);
+}
+
+void UEquipmentGASSubsystem::Swap(int32 ManagerId, int32 SlotIndex, const FItemInstance& Item,
+	const UItemFragment_Equipment* EquipFrag, UAbilitySystemComponent* ASC)
+{
+	FSlotRecord* Slot = FindSlot(ManagerId, SlotIndex);
+	if (!Slot || !ASC)
+	{
+		return;
+	}
+
+	// A null fragment here just means the new item grants nothing — the diff still clears the old grants
+	EquipFrag = ResolveFragment(Item, EquipFrag);
+
+	FManagerRecord& Record = Managers[ManagerId];
+	RegrantAbilities(Record, *Slot, EquipFrag, ASC);
+	RemoveEffects(Record, *Slot, ASC);
+	if (EquipFrag)
+	{
+		ApplyEffects(Record, *Slot, EquipFrag, ASC);
+	}
+}
+
+const UItemFragment_Equipment* UEquipmentGASSubsystem::ResolveFragment(const FItemInstance& Item,
+	const UItemFragment_Equipment* EquipFrag) const
+{
+	// Fall back to a database lookup only when the caller didn't resolve the fragment
+	if (EquipFrag)
+	{
+		return EquipFrag;
+	}
+
+	UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	UItemDatabaseSubsystem* DB = GI ? GI->GetSubsystem<UItemDatabaseSubsystem>() : nullptr;
+	UItemDefinition* Def = DB ? DB->GetDefinition(Item.ItemDefinitionId) : nullptr;
+	return Def ? Def->FindFragment<UItemFragment_Equipment>() : nullptr;
+}
+
+// ===========================================================================
+// Abilities
+// ===========================================================================
+
+void UEquipmentGASSubsystem::GrantAbilities(const FManagerRecord& Record, FSlotRecord& Slot,
+	const UItemFragment_Equipment* EquipFrag, UAbilitySystemComponent* ASC)
+{
+	for (const TSubclassOf<UGameplayAbility>& AbilityClass : EquipFrag->GrantedAbilities)
+	{
+		if (!AbilityClass)
+		{
+			continue;
+		}
+
+		FGameplayAbilitySpec Spec(AbilityClass, 1, INDEX_NONE, Record.Manager.Get());
+		FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(Spec);
+		if (Handle.IsValid())
+		{
+			Slot.AbilityHandles.Add(Handle);
+		}
+	}
+}
+
+void UEquipmentGASSubsystem::RevokeAbilities(FSlotRecord& Slot, UAbilitySystemComponent* ASC)
+{
+	for (const FGameplayAbilitySpecHandle& Handle : Slot.AbilityHandles)
+	{
+		if (Handle.IsValid())
+		{
+			ASC->ClearAbility(Handle);
+		}
+	}
+
+	Slot.AbilityHandles.Reset();
+}
+
+void UEquipmentGASSubsystem::RegrantAbilities(const FManagerRecord& Record, FSlotRecord& Slot,
+	const UItemFragment_Equipment* EquipFrag, UAbilitySystemComponent* ASC)
+{
+	TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>> OldHandles = MoveTemp(Slot.AbilityHandles);
+	Slot.AbilityHandles.Reset();
+
+	TArray<TSubclassOf<UGameplayAbility>, TInlineAllocator<2>> ToGrant;
+
+	if (EquipFrag)
+	{
+		for (const TSubclassOf<UGameplayAbility>& AbilityClass : EquipFrag->GrantedAbilities)
+		{
+			if (!AbilityClass)
+			{
+				continue;
+			}
+
+			// Match one old spec per class, so duplicates pair up one-to-one
+			const int32 OldIndex = OldHandles.IndexOfByPredicate([ASC, &AbilityClass](const FGameplayAbilitySpecHandle& Handle)
+			{
+				const FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Handle);
+				return Spec && Spec->Ability && Spec->Ability->GetClass() == AbilityClass;
+			});
+
+			if (OldIndex != INDEX_NONE)
+			{
+				Slot.AbilityHandles.Add(OldHandles[OldIndex]);
+				OldHandles.RemoveAtSwap(OldIndex);
+			}
+			else
+			{
+				ToGrant.Add(AbilityClass);
+			}
+		}
+	}
+
+	// Old item only
+	for (const FGameplayAbilitySpecHandle& Handle : OldHandles)
+	{
+		if (Handle.IsValid())
+		{
+			ASC->ClearAbility(Handle);
+		}
+	}
+
+	// New item only
+	for (const TSubclassOf<UGameplayAbility>& AbilityClass : ToGrant)
+	{
+		FGameplayAbilitySpec Spec(AbilityClass, 1, INDEX_NONE, Record.Manager.Get());
+		FGameplayAbilitySpecHandle Handle = ASC->GiveAbility(Spec);
+		if (Handle.IsValid())
+		{
+			Slot.AbilityHandles.Add(Handle);
+		}
+	}
+}
+
+// ===========================================================================
+// Effects
+// ===========================================================================
+
+void UEquipmentGASSubsystem::ApplyEffects(FManagerRecord& Record, FSlotRecord& Slot,
+	const UItemFragment_Equipment* EquipFrag, UAbilitySystemComponent* ASC)
+{
+	const TArray<FStatChannel>* Channels = Record.AggregatedStatsEffect
+		? &GetStatChannels(Record.AggregatedStatsEffect) : nullptr;
+
+	// Apply passive effects (tracked — removed on unequip)
+	for (const TSubclassOf<UGameplayEffect>& EffectClass : EquipFrag->PassiveEffects)
+	{
+		if (!EffectClass)
+		{
+			continue;
+		}
+
+		// Folded into the aggregated stats effect — applied on commit
+		if (Channels && FoldPassiveEffect(EffectClass->GetDefaultObject<UGameplayEffect>(), *Channels, Slot.StatContributions))
+		{
+			Record.bStatsDirty = true;
+			continue;
+		}
+
+		FActiveGameplayEffectHandle Handle = ApplyEffectFromTemplate(Record, EffectClass, ASC);
+		if (Handle.IsValid())
+		{
+			Slot.EffectHandles.Add(Handle);
+		}
+	}
+
+	// Apply on-equip effects (fire-and-forget — NOT stored for removal)
+	for (const TSubclassOf<UGameplayEffect>& EffectClass : EquipFrag->OnEquipEffects)
+	{
+		if (!EffectClass)
+		{
+			continue;
+		}
+
+		ApplyEffectFromTemplate(Record, EffectClass, ASC);
+	}
+}
+
+void UEquipmentGASSubsystem::RemoveEffects(FManagerRecord& Record, FSlotRecord& Slot, UAbilitySystemComponent* ASC)
+{
+	if (Slot.StatContributions.Num() > 0)
+	{
+		Slot.StatContributions.Reset();
+		Record.bStatsDirty = true;
+	}
+
+	for (const FActiveGameplayEffectHandle& Handle : Slot.EffectHandles)
+	{
+		if (Handle.IsValid())
+		{
+			ASC->RemoveActiveGameplayEffect(Handle);
+		}
+	}
+
+	Slot.EffectHandles.Reset();
+}
+
+FActiveGameplayEffectHandle UEquipmentGASSubsystem::ApplyEffectFromTemplate(FManagerRecord& Record,
+	TSubclassOf<UGameplayEffect> EffectClass, UAbilitySystemComponent* ASC)
+{
+	if (Record.TemplateASC != ASC)
+	{
+		Record.SpecTemplates.Reset();
+		Record.TemplateASC = ASC;
+	}
+
+	const TObjectKey<UClass> ClassKey(EffectClass.Get());
+	FSpecTemplate* Template = Record.SpecTemplates.FindByPredicate([&ClassKey](const FSpecTemplate& Candidate)
+	{
+		return Candidate.EffectClass == ClassKey;
+	});
+
+	if (!Template)
+	{
+		// Source object is the manager, not the item, so one template serves every item granting this effect
+		FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
+		Context.AddSourceObject(Record.Manager.Get());
+		FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(EffectClass, 1, Context);
+		if (!Spec.IsValid())
+		{
+			return FActiveGameplayEffectHandle();
+		}
+		Template = &Record.SpecTemplates.Add_GetRef({ ClassKey, Spec });
+	}
+
+	FGameplayEffectSpec Spec(*Template->Spec.Data);
+
+	// The copy shares the template's context handle — give each application its own context, so
+	// anything written to it afterwards (hit results, origin) doesn't leak into the template or other clones.
+	// Source tags are captured just below.
+	Spec.SetContext(Template->Spec.Data->GetContext().Duplicate(), /*bSkipRecaptureSourceActorTags*/ true);
+
+	// The template's source snapshot is from when it was built — recapture source tags and attributes
+	// and re-evaluate the duration from them. Modifier magnitudes are calculated on application.
+	Spec.CaptureDataFromSource();
+
+	return ASC->ApplyGameplayEffectSpecToSelf(Spec);
+}
+
+// ===========================================================================
+// Aggregated Stats
+// ===========================================================================
+
+const TArray<UEquipmentGASSubsystem::FStatChannel>& UEquipmentGASSubsystem::GetStatChannels(
+	TSubclassOf<UGameplayEffect> AggregatedStatsEffect)
+{
+	const TObjectKey<UClass> ClassKey(AggregatedStatsEffect.Get());
+	if (const TArray<FStatChannel>* Existing = StatChannelsByEffect.Find(ClassKey))
+	{
+		return *Existing;
+	}
+
+	TArray<FStatChannel>& Channels = StatChannelsByEffect.Add(ClassKey);
+	AggregatedStatsEffects.Add(AggregatedStatsEffect);
+
+	const UGameplayEffect* EffectCDO = AggregatedStatsEffect->GetDefaultObject<UGameplayEffect>();
+	if (!EffectCDO || EffectCDO->DurationPolicy != EGameplayEffectDurationType::Infinite)
+	{
+		return Channels;
+	}
+
+	for (const FGameplayModifierInfo& Modifier : EffectCDO->Modifiers)
+	{
+		const bool bFoldableOp = Modifier.ModifierOp == EGameplayModOp::Additive
+			|| Modifier.ModifierOp == EGameplayModOp::Multiplicitive
+			|| Modifier.ModifierOp == EGameplayModOp::Division;
+
+		if (!bFoldableOp || !Modifier.Attribute.IsValid()
+			|| Modifier.ModifierMagnitude.GetMagnitudeCalculationType() != EGameplayEffectMagnitudeCalculation::SetByCaller)
+		{
+			continue;
+		}
+
+		const FGameplayTag DataTag = Modifier.ModifierMagnitude.GetSetByCallerFloat().DataTag;
+		if (DataTag.IsValid())
+		{
+			Channels.Add({ Modifier.Attribute, Modifier.ModifierOp, DataTag });
+		}
+	}
+
+	return Channels;
+}
+
+bool UEquipmentGASSubsystem::FoldPassiveEffect(const UGameplayEffect* Effect,
+	const TArray<FStatChannel>& Channels, TArray<FStatContribution, TInlineAllocator<4>>& OutContributions)
+{
+	// Only plain stat blocks fold — anything with behaviour of its own keeps its own active effect.
+	// Granted tags and application/ongoing/removal tag requirements all live in GE components,
+	// so any component at all rules folding out.
+	if (!Effect
+		|| Effect->DurationPolicy != EGameplayEffectDurationType::Infinite
+		|| Effect->Period.GetValueAtLevel(1) > 0.f
+		|| Effect->Executions.Num() > 0
+		|| Effect->Modifiers.Num() == 0
+		|| Effect->GameplayCues.Num() > 0
+		|| Effect->GetStackingType() != EGameplayEffectStackingType::None
+		|| Effect->FindComponent(UGameplayEffectComponent::StaticClass()) != nullptr)
+	{
+		return false;
+	}
+
+	const int32 FirstNew = OutContributions.Num();
+
+	for (const FGameplayModifierInfo& Modifier : Effect->Modifiers)
+	{
+		float Magnitude = 0.f;
+		const int32 Channel = Channels.IndexOfByPredicate([&Modifier](const FStatChannel& Candidate)
+		{
+			return Candidate.Attribute == Modifier.Attribute && Candidate.ModOp == Modifier.ModifierOp;
+		});
+
+		if (Channel == INDEX_NONE
+			|| !Modifier.SourceTags.IsEmpty() || !Modifier.TargetTags.IsEmpty()
+			|| !Modifier.ModifierMagnitude.GetStaticMagnitudeIfPossible(1, Magnitude))
+		{
+			OutContributions.SetNum(FirstNew);
+			return false;
+		}
+
+		// GAS sums multiply/divide modifiers as biases (1 + sum(M - 1)), so fold them the same way
+		if (Modifier.ModifierOp != EGameplayModOp::Additive)
+		{
+			Magnitude -= 1.f;
+		}
+
+		OutContributions.Add({ Channel, Magnitude });
+	}
+
+	return true;
+}
+
+void UEquipmentGASSubsystem::CommitAggregatedStats(int32 ManagerId, UAbilitySystemComponent* ASC)
+{
+	FManagerRecord* Record = FindManager(ManagerId);
+	if (!Record || !Record->bStatsDirty || !ASC || !Record->AggregatedStatsEffect)
+	{
+		return;
+	}
+
+	Record->bStatsDirty = false;
+
+	const TArray<FStatChannel>& Channels = GetStatChannels(Record->AggregatedStatsEffect);
+
+	TArray<float, TInlineAllocator<16>> Totals;
+	Totals.SetNumZeroed(Channels.Num());
+	bool bAnyFolded = false;
+
+	for (int32 Index = Record->FirstSlot; Index < Record->FirstSlot + Record->SlotCount; ++Index)
+	{
+		for (const FStatContribution& Contribution : SlotRecords[Index].StatContributions)
+		{
+			Totals[Contribution.Channel] += Contribution.Magnitude;
+			bAnyFolded = true;
+		}
+	}
+
+	const bool bEffectActive = Record->AggregatedStatsHandle.IsValid()
+		&& ASC->GetActiveGameplayEffect(Record->AggregatedStatsHandle);
+
+	// Nothing folded — drop the effect rather than keep a neutral one around
+	if (!bAnyFolded)
+	{
+		if (bEffectActive)
+		{
+			ASC->RemoveActiveGameplayEffect(Record->AggregatedStatsHandle);
+		}
+		Record->AggregatedStatsHandle.Invalidate();
+		return;
+	}
+
+	TMap<FGameplayTag, float> Magnitudes;
+	Magnitudes.Reserve(Channels.Num());
+	for (int32 i = 0; i < Channels.Num(); ++i)
+	{
+		const float Neutral = Channels[i].ModOp == EGameplayModOp::Additive ? 0.f : 1.f;
+		Magnitudes.Add(Channels[i].DataTag, Neutral + Totals[i]);
+	}
+
+	// Already on the ASC — update the magnitudes in place instead of re-applying
+	if (bEffectActive)
+	{
+		ASC->UpdateActiveGameplayEffectSetByCallerMagnitudes(Record->AggregatedStatsHandle, Magnitudes);
+		return;
+	}
+
+	FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
+	Context.AddSourceObject(Record->Manager.Get());
+	FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(Record->AggregatedStatsEffect, 1, Context);
+	if (!Spec.IsValid())
+	{
+		return;
+	}
+
+	for (const TPair<FGameplayTag, float>& Pair : Magnitudes)
+	{
+		Spec.Data->SetSetByCallerMagnitude(Pair.Key, Pair.Value);
+	}
+	Record->AggregatedStatsHandle = ASC->ApplyGameplayEffectSpecToSelf(*Spec.Data);
+}
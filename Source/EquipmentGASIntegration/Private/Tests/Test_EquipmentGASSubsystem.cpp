@@ -0,0 +1,237 @@
+#include "Misc/AutomationTest.h"
+#include "EquipmentGASSubsystem.h"
+#include "Components/EquipmentManagerComponent.h"
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility_CharacterJump.h"
+#include "Abilities/GameplayAbility_Montage.h"
+#include "Types/CGFItemTypes.h"
+#include "Types/CGFEquipmentTypes.h"
+#include "Data/Fragments/ItemFragment_Equipment.h"
+#include "GameplayEffect.h"
+#include "GameplayEffectComponents/TargetTagRequirementsGameplayEffectComponent.h"
+#include "GameFramework/Actor.h"
+
+#if WITH_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Private access for tests — declared a friend of UEquipmentGASSubsystem
+// ---------------------------------------------------------------------------
+struct FEquipmentGASSubsystemTestAccess
+{
+	using FStatChannel = UEquipmentGASSubsystem::FStatChannel;
+	using FStatContribution = UEquipmentGASSubsystem::FStatContribution;
+	using FContributions = TArray<FStatContribution, TInlineAllocator<4>>;
+
+	static bool FoldPassiveEffect(const UGameplayEffect* Effect, const TArray<FStatChannel>& Channels,
+		FContributions& OutContributions)
+	{
+		return UEquipmentGASSubsystem::FoldPassiveEffect(Effect, Channels, OutContributions);
+	}
+
+	static TArray<FGameplayAbilitySpecHandle> GetAbilityHandles(UEquipmentGASSubsystem* Subsystem, int32 ManagerId,
+		int32 SlotIndex)
+	{
+		const UEquipmentGASSubsystem::FSlotRecord* Slot = Subsystem->FindSlot(ManagerId, SlotIndex);
+		return Slot ? TArray<FGameplayAbilitySpecHandle>(Slot->AbilityHandles) : TArray<FGameplayAbilitySpecHandle>();
+	}
+};
+
+// ---------------------------------------------------------------------------
+// Helpers: transient effects with constant modifiers. Any numeric property makes a
+// valid attribute for folding, which only matches attribute + op against the channels.
+// ---------------------------------------------------------------------------
+namespace EquipmentGASTestHelpers
+{
+	using FTestAccess = FEquipmentGASSubsystemTestAccess;
+
+	FGameplayAttribute TestAttribute(const TCHAR* PropertyName)
+	{
+		return FGameplayAttribute(FindFProperty<FProperty>(AActor::StaticClass(), PropertyName));
+	}
+
+	FGameplayAttribute AttributeA() { return TestAttribute(TEXT("CustomTimeDilation")); }
+	FGameplayAttribute AttributeB() { return TestAttribute(TEXT("InitialLifeSpan")); }
+
+	TArray<FTestAccess::FStatChannel> CreateChannels()
+	{
+		TArray<FTestAccess::FStatChannel> Channels;
+		Channels.Add({ AttributeA(), EGameplayModOp::Additive, FGameplayTag() });
+		Channels.Add({ AttributeA(), EGameplayModOp::Multiplicitive, FGameplayTag() });
+		Channels.Add({ AttributeB(), EGameplayModOp::Division, FGameplayTag() });
+		return Channels;
+	}
+
+	UGameplayEffect* CreateStatEffect(const FGameplayAttribute& Attribute, EGameplayModOp::Type ModOp, float Magnitude)
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), NAME_None, RF_Transient);
+		Effect->DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+		FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+		Modifier.Attribute = Attribute;
+		Modifier.ModifierOp = ModOp;
+		Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(Magnitude));
+		return Effect;
+	}
+}
+
+// ===========================================================================
+// Folding — multiply/divide as biases
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipGAS_FoldBias,
+	"Equipment.GAS.AggregatedStats.FoldBias",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipGAS_FoldBias::RunTest(const FString& Parameters)
+{
+	using namespace EquipmentGASTestHelpers;
+
+	const TArray<FTestAccess::FStatChannel> Channels = CreateChannels();
+	FTestAccess::FContributions Contributions;
+
+	TestTrue("Additive folds", FTestAccess::FoldPassiveEffect(
+		CreateStatEffect(AttributeA(), EGameplayModOp::Additive, 10.f), Channels, Contributions));
+	TestTrue("First multiply folds", FTestAccess::FoldPassiveEffect(
+		CreateStatEffect(AttributeA(), EGameplayModOp::Multiplicitive, 1.5f), Channels, Contributions));
+	TestTrue("Second multiply folds", FTestAccess::FoldPassiveEffect(
+		CreateStatEffect(AttributeA(), EGameplayModOp::Multiplicitive, 1.2f), Channels, Contributions));
+	TestTrue("Divide folds", FTestAccess::FoldPassiveEffect(
+		CreateStatEffect(AttributeB(), EGameplayModOp::Division, 2.f), Channels, Contributions));
+
+	if (!TestEqual("One contribution per modifier", Contributions.Num(), 4))
+	{
+		return false;
+	}
+
+	TestEqual("Additive channel", Contributions[0].Channel, 0);
+	TestEqual("Additive kept as-is", Contributions[0].Magnitude, 10.f);
+	TestEqual("Multiply channel", Contributions[1].Channel, 1);
+	TestEqual("Multiply stored as bias", Contributions[1].Magnitude, 0.5f, KINDA_SMALL_NUMBER);
+	TestEqual("Divide channel", Contributions[3].Channel, 2);
+	TestEqual("Divide stored as bias", Contributions[3].Magnitude, 1.f, KINDA_SMALL_NUMBER);
+
+	// Commit sums biases onto the neutral value — 1 + (0.5 + 0.2), as GAS combines two separate effects
+	const float MultiplyTotal = 1.f + Contributions[1].Magnitude + Contributions[2].Magnitude;
+	TestEqual("Summed multiply matches GAS bias aggregation", MultiplyTotal, 1.7f, KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+// ===========================================================================
+// Folding — effects with behaviour of their own are applied normally
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipGAS_FoldFallback,
+	"Equipment.GAS.AggregatedStats.NonFoldableFallback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipGAS_FoldFallback::RunTest(const FString& Parameters)
+{
+	using namespace EquipmentGASTestHelpers;
+
+	const TArray<FTestAccess::FStatChannel> Channels = CreateChannels();
+	FTestAccess::FContributions Contributions;
+
+	UGameplayEffect* WithCue = CreateStatEffect(AttributeA(), EGameplayModOp::Additive, 5.f);
+	WithCue->GameplayCues.Add(FGameplayEffectCue(FGameplayTag::RequestGameplayTag(TEXT("GameplayCue.Test"), false), 0.f, 1.f));
+	TestFalse("Gameplay cue not folded", FTestAccess::FoldPassiveEffect(WithCue, Channels, Contributions));
+
+	UGameplayEffect* WithRequirements = CreateStatEffect(AttributeA(), EGameplayModOp::Additive, 5.f);
+	WithRequirements->AddComponent<UTargetTagRequirementsGameplayEffectComponent>();
+	TestFalse("Tag requirements not folded", FTestAccess::FoldPassiveEffect(WithRequirements, Channels, Contributions));
+
+	UGameplayEffect* Instant = CreateStatEffect(AttributeA(), EGameplayModOp::Additive, 5.f);
+	Instant->DurationPolicy = EGameplayEffectDurationType::Instant;
+	TestFalse("Instant not folded", FTestAccess::FoldPassiveEffect(Instant, Channels, Contributions));
+
+	UGameplayEffect* NoChannel = CreateStatEffect(AttributeB(), EGameplayModOp::Additive, 5.f);
+	TestFalse("Modifier without a channel not folded", FTestAccess::FoldPassiveEffect(NoChannel, Channels, Contributions));
+
+	// A partly foldable effect must not leave its earlier modifiers behind
+	UGameplayEffect* Partial = CreateStatEffect(AttributeA(), EGameplayModOp::Additive, 5.f);
+	FGameplayModifierInfo& Unmatched = Partial->Modifiers.AddDefaulted_GetRef();
+	Unmatched.Attribute = AttributeB();
+	Unmatched.ModifierOp = EGameplayModOp::Additive;
+	Unmatched.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(1.f));
+	TestFalse("Partly foldable effect not folded", FTestAccess::FoldPassiveEffect(Partial, Channels, Contributions));
+
+	TestEqual("Nothing appended by rejected effects", Contributions.Num(), 0);
+	return true;
+}
+
+// ===========================================================================
+// Swap — ability grants are diffed
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipGAS_SwapAbilityDiff,
+	"Equipment.GAS.Swap.AbilityDiff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipGAS_SwapAbilityDiff::RunTest(const FString& Parameters)
+{
+	using FTestAccess = FEquipmentGASSubsystemTestAccess;
+
+	UEquipmentManagerComponent* Manager = NewObject<UEquipmentManagerComponent>();
+	Manager->AddToRoot();
+	Manager->AvailableSlots.AddDefaulted();
+
+	UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>();
+	ASC->AddToRoot();
+
+	UEquipmentGASSubsystem* Subsystem = NewObject<UEquipmentGASSubsystem>();
+	const int32 ManagerId = Subsystem->RegisterManager(Manager, nullptr);
+
+	const TSubclassOf<UGameplayAbility> Shared = UGameplayAbility_CharacterJump::StaticClass();
+	const TSubclassOf<UGameplayAbility> Other = UGameplayAbility_Montage::StaticClass();
+
+	UItemFragment_Equipment* BothFrag = NewObject<UItemFragment_Equipment>();
+	BothFrag->GrantedAbilities = { Shared, Other };
+	UItemFragment_Equipment* SharedOnlyFrag = NewObject<UItemFragment_Equipment>();
+	SharedOnlyFrag->GrantedAbilities = { Shared };
+
+	FItemInstance Item;
+	Item.InstanceId = FGuid::NewGuid();
+
+	const auto FindHandleOf = [ASC](const TArray<FGameplayAbilitySpecHandle>& Handles, TSubclassOf<UGameplayAbility> AbilityClass)
+	{
+		for (const FGameplayAbilitySpecHandle& Handle : Handles)
+		{
+			const FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Handle);
+			if (Spec && Spec->Ability && Spec->Ability->GetClass() == AbilityClass)
+			{
+				return Handle;
+			}
+		}
+		return FGameplayAbilitySpecHandle();
+	};
+
+	Subsystem->Equip(ManagerId, 0, Item, BothFrag, ASC);
+	const FGameplayAbilitySpecHandle SharedHandle = FindHandleOf(FTestAccess::GetAbilityHandles(Subsystem, ManagerId, 0), Shared);
+	const FGameplayAbilitySpecHandle OtherHandle = FindHandleOf(FTestAccess::GetAbilityHandles(Subsystem, ManagerId, 0), Other);
+	TestTrue("Shared ability granted", SharedHandle.IsValid());
+	TestTrue("Old-only ability granted", OtherHandle.IsValid());
+
+	// Old item only → revoked; shared → kept under the same spec
+	Subsystem->Swap(ManagerId, 0, Item, SharedOnlyFrag, ASC);
+	TArray<FGameplayAbilitySpecHandle> Handles = FTestAccess::GetAbilityHandles(Subsystem, ManagerId, 0);
+	TestEqual("One grant after swap", Handles.Num(), 1);
+	TestEqual("Shared spec survives the swap", FindHandleOf(Handles, Shared), SharedHandle);
+	TestNull("Old-only ability revoked", ASC->FindAbilitySpecFromHandle(OtherHandle));
+
+	// New item only → granted; shared → still the original spec
+	Subsystem->Swap(ManagerId, 0, Item, BothFrag, ASC);
+	Handles = FTestAccess::GetAbilityHandles(Subsystem, ManagerId, 0);
+	TestEqual("Two grants after swapping back", Handles.Num(), 2);
+	TestEqual("Shared spec survives again", FindHandleOf(Handles, Shared), SharedHandle);
+	TestTrue("New-only ability granted", FindHandleOf(Handles, Other).IsValid());
+	TestEqual("ASC holds exactly the slot's grants", ASC->GetActivatableAbilities().Num(), 2);
+
+	Subsystem->UnregisterManager(ManagerId, ASC);
+	TestEqual("Unregister revokes every grant", ASC->GetActivatableAbilities().Num(), 0);
+
+	ASC->RemoveFromRoot();
+	Manager->RemoveFromRoot();
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
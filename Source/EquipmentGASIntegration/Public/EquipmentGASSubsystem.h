@@ -0,0 +1,165 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
+#include "GameplayAbilitySpecHandle.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "AttributeSet.h"
+#include "UObject/ObjectKey.h"
+#include "EquipmentGASSubsystem.generated.h"
+
+struct FItemInstance;
+class UAbilitySystemComponent;
+class UEquipmentManagerComponent;
+class UGameplayEffect;
+class UItemFragment_Equipment;
+
+/**
+ * Grants/revokes abilities and applies/removes effects for every equipment manager in the world.
+ * Replaces a granter and an applier UObject per component: handle bookkeeping lives in flat
+ * arrays indexed by (manager id, slot index), so components carry no extra objects or maps.
+ * All operations are server-only — ASC replication handles clients.
+ *
+ * Passive effects are applied by cloning per-manager spec templates. With an aggregated stats
+ * effect, plain constant-modifier passives are folded into that one effect's SetByCaller
+ * magnitudes on commit. Slot swaps re-grant by diff, keeping abilities both items share.
+ */
+UCLASS()
+class EQUIPMENTGASINTEGRATION_API UEquipmentGASSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	friend struct FEquipmentGASSubsystemTestAccess;
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Reserve a record and a block of slot records for Manager. The id addresses it in every other call. */
+	int32 RegisterManager(UEquipmentManagerComponent* Manager, TSubclassOf<UGameplayEffect> AggregatedStatsEffect);
+
+	/**
+	 * Revoke the manager's abilities, remove its effects and aggregated stats effect from ASC, then free its records.
+	 * With a null ASC (already destroyed) the handles are just dropped.
+	 */
+	void UnregisterManager(int32 ManagerId, UAbilitySystemComponent* ASC);
+
+	/**
+	 * Grant the item's abilities and apply its effects to the slot.
+	 * EquipFrag is the fragment the equipment manager already resolved; if null it is looked up.
+	 */
+	void Equip(int32 ManagerId, int32 SlotIndex, const FItemInstance& Item, const UItemFragment_Equipment* EquipFrag,
+		UAbilitySystemComponent* ASC);
+
+	/** Revoke the slot's abilities and remove its passive effects */
+	void Unequip(int32 ManagerId, int32 SlotIndex, UAbilitySystemComponent* ASC);
+
+	/** Replace the slot's item — abilities both items grant are kept, only the difference changes */
+	void Swap(int32 ManagerId, int32 SlotIndex, const FItemInstance& Item, const UItemFragment_Equipment* EquipFrag,
+		UAbilitySystemComponent* ASC);
+
+	/** Push summed stats to the manager's aggregated effect if any slot changed since the last commit */
+	void CommitAggregatedStats(int32 ManagerId, UAbilitySystemComponent* ASC);
+
+private:
+	/** One SetByCaller modifier of an aggregated stats effect */
+	struct FStatChannel
+	{
+		FGameplayAttribute Attribute;
+		TEnumAsByte<EGameplayModOp::Type> ModOp;
+		FGameplayTag DataTag;
+	};
+
+	/** A folded modifier: channel index and magnitude (bias form for multiply/divide) */
+	struct FStatContribution
+	{
+		int32 Channel = INDEX_NONE;
+		float Magnitude = 0.f;
+	};
+
+	/** Prebuilt level 1 outgoing spec, cloned on application */
+	struct FSpecTemplate
+	{
+		TObjectKey<UClass> EffectClass;
+		FGameplayEffectSpecHandle Spec;
+	};
+
+	/** GAS handles for one equipment slot */
+	struct FSlotRecord
+	{
+		TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>> AbilityHandles;
+		TArray<FActiveGameplayEffectHandle, TInlineAllocator<2>> EffectHandles;
+		TArray<FStatContribution, TInlineAllocator<4>> StatContributions;
+	};
+
+	/** Per-manager state — its slots are SlotRecords[FirstSlot, FirstSlot + SlotCount) */
+	struct FManagerRecord
+	{
+		TWeakObjectPtr<UEquipmentManagerComponent> Manager;
+		int32 FirstSlot = 0;
+		int32 SlotCount = 0;
+
+		/** Aggregated stats effect — null when aggregation is off */
+		TSubclassOf<UGameplayEffect> AggregatedStatsEffect;
+		FActiveGameplayEffectHandle AggregatedStatsHandle;
+		bool bStatsDirty = false;
+
+		/** Spec templates, built against TemplateASC — a different ASC flushes them */
+		TArray<FSpecTemplate> SpecTemplates;
+		TWeakObjectPtr<UAbilitySystemComponent> TemplateASC;
+	};
+
+	/** A run of SlotRecords released by an unregistered manager */
+	struct FSlotBlock
+	{
+		int32 FirstSlot = 0;
+		int32 SlotCount = 0;
+	};
+
+	/** Record for ManagerId, or null if the id is stale */
+	FManagerRecord* FindManager(int32 ManagerId);
+
+	/** Slot record for (ManagerId, SlotIndex), or null if either is out of range */
+	FSlotRecord* FindSlot(int32 ManagerId, int32 SlotIndex);
+
+	/** EquipFrag, or the item's fragment looked up from the item database */
+	const UItemFragment_Equipment* ResolveFragment(const FItemInstance& Item, const UItemFragment_Equipment* EquipFrag) const;
+
+	void GrantAbilities(const FManagerRecord& Record, FSlotRecord& Slot, const UItemFragment_Equipment* EquipFrag,
+		UAbilitySystemComponent* ASC);
+	void RevokeAbilities(FSlotRecord& Slot, UAbilitySystemComponent* ASC);
+	void RegrantAbilities(const FManagerRecord& Record, FSlotRecord& Slot, const UItemFragment_Equipment* EquipFrag,
+		UAbilitySystemComponent* ASC);
+	void ApplyEffects(FManagerRecord& Record, FSlotRecord& Slot, const UItemFragment_Equipment* EquipFrag,
+		UAbilitySystemComponent* ASC);
+	void RemoveEffects(FManagerRecord& Record, FSlotRecord& Slot, UAbilitySystemComponent* ASC);
+
+	/** Apply EffectClass at level 1 from the manager's spec template, built on first use */
+	FActiveGameplayEffectHandle ApplyEffectFromTemplate(FManagerRecord& Record, TSubclassOf<UGameplayEffect> EffectClass,
+		UAbilitySystemComponent* ASC);
+
+	/** SetByCaller channels of an aggregated stats effect, read once per class */
+	const TArray<FStatChannel>& GetStatChannels(TSubclassOf<UGameplayEffect> AggregatedStatsEffect);
+
+	/**
+	 * Append Effect's modifiers as channel contributions. False (and nothing appended) if it can't be folded:
+	 * cues, stacking, GE components (granted tags, tag requirements, ...) and non-constant modifiers keep
+	 * the effect on its own active handle.
+	 */
+	static bool FoldPassiveEffect(const UGameplayEffect* Effect, const TArray<FStatChannel>& Channels,
+		TArray<FStatContribution, TInlineAllocator<4>>& OutContributions);
+
+	TArray<FManagerRecord> Managers;
+	TArray<int32> FreeManagerIds;
+
+	TArray<FSlotRecord> SlotRecords;
+	TArray<FSlotBlock> FreeSlotBlocks;
+
+	/** Channels per aggregated stats effect class, shared by every manager using it */
+	TMap<TObjectKey<UClass>, TArray<FStatChannel>> StatChannelsByEffect;
+
+	/** Keeps aggregated stats effect classes alive while managers reference them */
+	UPROPERTY()
+	TArray<TSubclassOf<UGameplayEffect>> AggregatedStatsEffects;
+};
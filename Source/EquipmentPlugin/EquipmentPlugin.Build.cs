@@ -20,6 +20,7 @@ public class EquipmentPlugin : ModuleRules
 		{
 			"ItemInventoryPlugin",
 			"InputCore",
+			"SkeletalMerging",
 			"UMG",
 			"Slate",
 			"SlateCore",
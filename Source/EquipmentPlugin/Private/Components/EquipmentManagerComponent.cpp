@@ -1,17 +1,29 @@
 #include "Components/EquipmentManagerComponent.h"
 #include "Components/InventoryComponent.h"
+#include "Subsystems/EquipmentMeshMergeSubsystem.h"
+#include "Subsystems/EquipmentVisualSubsystem.h"
 #include "Subsystems/ItemDatabaseSubsystem.h"
 #include "Data/ItemDefinition.h"
 #include "Data/Fragments/ItemFragment_Equipment.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Animation/AnimInstance.h"
 #include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "Misc/ScopeExit.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 // Static factory delegate — set by EquipmentGASIntegration module
 TFunction<void(UEquipmentManagerComponent*)> UEquipmentManagerComponent::GASSetupFactory;
 
 UEquipmentManagerComponent::UEquipmentManagerComponent()
+	: EquipmentSlots(this)
+	, VisualSlots(this)
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
@@ -21,16 +33,56 @@ void UEquipmentManagerComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Create runtime slots from definitions
-	EquipmentSlots.Reset();
-	for (const FEquipmentSlotDefinition& Def : AvailableSlots)
+	// Owner components may have been added since any pre-play lookup
+	InvalidateOwnerBindings();
+
+	if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	{
+		OwnerPawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &UEquipmentManagerComponent::HandleOwnerControllerChanged);
+	}
+
+	// Slot indices go on the wire as uint8 with MAX_uint8 reserved for NoSlotIndex — a larger layout
+	// can't be addressed, so reject it outright on every machine rather than misroute the last slot
+	if (AvailableSlots.Num() >= NoSlotIndex)
+	{
+		UE_LOG(LogTemp, Error, TEXT("EquipmentManager: %d slots defined on %s, at most %d are supported. No slots created."),
+			AvailableSlots.Num(), *GetNameSafe(GetOwner()), NoSlotIndex - 1);
+		AvailableSlots.Reset();
+	}
+
+	// Create runtime slots from definitions (server only — clients receive them via replication)
+	if (!GetOwner() || GetOwner()->HasAuthority())
+	{
+		EquipmentSlots.Slots.Reset();
+		for (int32 Index = 0; Index < AvailableSlots.Num(); ++Index)
+		{
+			FEquipmentSlot& Slot = EquipmentSlots.Slots.AddDefaulted_GetRef();
+			ApplySlotDefinition(Slot, Index);
+		}
+		EquipmentSlots.MarkArrayDirty();
+		MARK_PROPERTY_DIRTY_FROM_NAME(UEquipmentManagerComponent, EquipmentSlots, this);
+
+		// One compact visual record per slot for simulated proxies
+		VisualSlots.Items.Reset();
+		for (int32 Index = 0; Index < AvailableSlots.Num(); ++Index)
+		{
+			FEquipmentVisualSlot Record;
+			Record.SlotIndex = static_cast<uint8>(Index);
+			VisualSlots.Items.Add(Record);
+		}
+		VisualSlots.MarkArrayDirty();
+		MARK_PROPERTY_DIRTY_FROM_NAME(UEquipmentManagerComponent, VisualSlots, this);
+	}
+
+	RebuildSlotIndex();
+
+	// A dedicated server has no local view to tier against — server-side visuals stay Full for hit detection
+	if (bAutomaticVisualLOD && AreVisualsEnabled() && GetNetMode() != NM_DedicatedServer)
 	{
-		FEquipmentSlot Slot;
-		Slot.SlotTag = Def.SlotTag;
-		Slot.AttachSocket = Def.AttachSocket;
-		Slot.AcceptedItemTags = Def.AcceptedItemTags;
-		Slot.bIsOccupied = false;
-		EquipmentSlots.Add(Slot);
+		if (UEquipmentVisualSubsystem* VisualSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UEquipmentVisualSubsystem>() : nullptr)
+		{
+			VisualSubsystem->RegisterForVisualLOD(this);
+		}
 	}
 
 	// Initialize GAS integration if the module is loaded
@@ -40,31 +92,290 @@ void UEquipmentManagerComponent::BeginPlay()
 	}
 }
 
+void UEquipmentManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UEquipmentVisualSubsystem* VisualSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UEquipmentVisualSubsystem>() : nullptr)
+	{
+		VisualSubsystem->UnregisterForVisualLOD(this);
+	}
+
+	if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	{
+		OwnerPawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UEquipmentManagerComponent::HandleOwnerControllerChanged);
+	}
+
+	if (USkeletalMeshComponent* OwnerMesh = GetOwnerMesh())
+	{
+		for (const TSubclassOf<UAnimInstance>& LayerClass : LinkedAnimLayers)
+		{
+			OwnerMesh->UnlinkAnimClassLayers(LayerClass);
+		}
+	}
+	LinkedAnimLayers.Reset();
+	AnimLayerRefCounts.Reset();
+
+	TrimVisualComponentPool(0, 0);
+
+	// Whatever the GAS module keeps for us is gone after release — drop every callback into it
+	if (OnGASReleaseCallback)
+	{
+		OnGASReleaseCallback();
+	}
+	OnGASEquipCallback = nullptr;
+	OnGASUnequipCallback = nullptr;
+	OnGASSwapCallback = nullptr;
+	OnGASCommitCallback = nullptr;
+	OnGASReleaseCallback = nullptr;
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UEquipmentManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(UEquipmentManagerComponent, EquipmentSlots);
+
+	// Push-based: the net driver skips comparing idle equipment until MarkSlotDirty flags a change.
+	// The owner gets full item records; everyone else only gets what visuals need.
+	FDoRepLifetimeParams OwnerParams;
+	OwnerParams.bIsPushBased = true;
+	OwnerParams.Condition = COND_OwnerOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UEquipmentManagerComponent, EquipmentSlots, OwnerParams);
+
+	FDoRepLifetimeParams ProxyParams;
+	ProxyParams.bIsPushBased = true;
+	ProxyParams.Condition = COND_SkipOwner;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UEquipmentManagerComponent, VisualSlots, ProxyParams);
 }
 
 // ===========================================================================
 // Replication
 // ===========================================================================
 
-void UEquipmentManagerComponent::OnRep_EquipmentSlots()
+void FEquipmentSlot::PreReplicatedRemove(const FEquipmentSlotContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleSlotRemoved(*this);
+	}
+}
+
+void FEquipmentSlot::PostReplicatedAdd(const FEquipmentSlotContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleSlotReplicated(*this);
+	}
+}
+
+void FEquipmentSlot::PostReplicatedChange(const FEquipmentSlotContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleSlotReplicated(*this);
+	}
+}
+
+bool FEquipmentSlot::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// SlotTag, AttachSocket and AcceptedItemTags are static config every client already has
+	// in AvailableSlots — send the index and rebuild them on receipt (HandleSlotReplicated)
+	Ar << SlotIndex;
+
+	uint8 OccupiedBit = bIsOccupied ? 1 : 0;
+	Ar.SerializeBits(&OccupiedBit, 1);
+
+	bOutSuccess = true;
+
+	if (Ar.IsLoading())
+	{
+		bIsOccupied = OccupiedBit != 0;
+		if (!bIsOccupied)
+		{
+			EquippedItem = FItemInstance();
+		}
+	}
+
+	if (bIsOccupied)
+	{
+		UScriptStruct* ItemStruct = FItemInstance::StaticStruct();
+		if (ItemStruct->StructFlags & STRUCT_NetSerializeNative)
+		{
+			ItemStruct->GetCppStructOps()->NetSerialize(Ar, Map, bOutSuccess, &EquippedItem);
+		}
+		else
+		{
+			ItemStruct->SerializeBin(Ar, &EquippedItem);
+		}
+	}
+
+	return true;
+}
+
+void FEquipmentSlotContainer::PostReplicatedReceive(
+	const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (Owner)
+	{
+		Owner->HandleSlotsReplicated();
+	}
+}
+
+void FEquipmentVisualSlot::PostReplicatedAdd(const FEquipmentVisualSlotContainer& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleVisualSlotReplicated(*this);
+	}
+}
+
+void FEquipmentVisualSlot::PostReplicatedChange(const FEquipmentVisualSlotContainer& InArraySerializer)
 {
-	// Sync visuals on clients based on replicated state
-	for (FEquipmentSlot& Slot : EquipmentSlots)
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->HandleVisualSlotReplicated(*this);
+	}
+}
+
+void FEquipmentVisualSlotContainer::PostReplicatedReceive(
+	const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (Owner)
+	{
+		Owner->HandleSlotsReplicated();
+	}
+}
+
+void UEquipmentManagerComponent::HandleSlotReplicated(FEquipmentSlot& Slot)
+{
+	// Static config isn't replicated — rebuild it from the slot definition
+	if (!Slot.SlotTag.IsValid())
+	{
+		ApplySlotDefinition(Slot, Slot.SlotIndex);
+	}
+
+	// Array position is valid for the whole callback — removals are applied only after every add/change
+	const int32 SlotArrayIndex = static_cast<int32>(&Slot - EquipmentSlots.Slots.GetData());
+	if (!EquipmentSlots.Slots.IsValidIndex(SlotArrayIndex))
+	{
+		return;
+	}
+
+	// A slot the index doesn't know yet (initial receive) — re-index once in HandleSlotsReplicated,
+	// not once per added slot. Per-item changes only touch the occupancy bit.
+	if (GetSlotIndex(Slot.SlotTag) != SlotArrayIndex)
+	{
+		bSlotLayoutDirty = true;
+	}
+	else if (OccupancyMask.IsValidIndex(SlotArrayIndex))
+	{
+		OccupancyMask[SlotArrayIndex] = Slot.bIsOccupied;
+	}
+
+	MarkSlotChanged(SlotArrayIndex);
+
+	// Server state for this slot supersedes anything still predicted on it
+	if (PendingPredictions.Num() > 0)
+	{
+		PendingPredictions.RemoveAll([SlotArrayIndex](const FPredictedSlotChange& Change)
+		{
+			return Change.SlotArrayIndex == SlotArrayIndex;
+		});
+	}
+
+	// Only the dirty slot is processed — the item may have changed, so re-resolve and queue its visuals
+	// for the single batched load issued when the update finishes
+	if (Slot.bIsOccupied)
 	{
-		if (Slot.bIsOccupied && !Slot.AttachedVisualComponent)
+		// Same definition as already shown (e.g. a confirmed prediction, or only the instance changed) —
+		// the attached or in-flight visual is still right, so don't reload or reattach it
+		FEquipmentResolvedItem Resolved = ResolveItem(Slot.EquippedItem);
+		if (Slot.ResolvedItem.IsValid() && Resolved.Definition == Slot.ResolvedItem.Definition)
 		{
-			ApplyVisuals(Slot.EquippedItem, Slot.SlotTag);
+			return;
 		}
-		else if (!Slot.bIsOccupied && Slot.AttachedVisualComponent)
+
+		// Release the outgoing visual, load handle and anim layer while the outgoing ResolvedItem is still set —
+		// the flush skips items without a mesh or hidden by the tier, so nothing else would clear them
+		if (Slot.AttachedVisualComponent || Slot.MeshLoadHandle.IsValid() || Slot.ResolvedItem.IsValid())
 		{
 			RemoveVisuals(Slot.SlotTag);
 		}
+
+		Slot.ResolvedItem = MoveTemp(Resolved);
+		PendingReplicatedVisualSlots.AddUnique(Slot.SlotTag);
+	}
+	else if (Slot.AttachedVisualComponent || Slot.MeshLoadHandle.IsValid() || Slot.ResolvedItem.IsValid())
+	{
+		// RemoveVisuals reads the outgoing ResolvedItem — reset it only afterwards
+		RemoveVisuals(Slot.SlotTag);
+		Slot.ResolvedItem.Reset();
+	}
+}
+
+void UEquipmentManagerComponent::HandleSlotRemoved(FEquipmentSlot& Slot)
+{
+	RemoveVisuals(Slot.SlotTag);
+	bSlotLayoutDirty = true;
+}
+
+void UEquipmentManagerComponent::HandleVisualSlotReplicated(const FEquipmentVisualSlot& Record)
+{
+	EnsureProxySlots();
+
+	if (!EquipmentSlots.Slots.IsValidIndex(Record.SlotIndex))
+	{
+		return;
+	}
+
+	// Proxies only know the definition — enough to resolve the fragment and build visuals
+	FEquipmentSlot& Slot = EquipmentSlots.Slots[Record.SlotIndex];
+	Slot.EquippedItem = FItemInstance();
+	Slot.EquippedItem.ItemDefinitionId = Record.ItemDefinitionId;
+	Slot.bIsOccupied = Record.ItemDefinitionId.IsValid();
+
+	HandleSlotReplicated(Slot);
+}
+
+void UEquipmentManagerComponent::EnsureProxySlots()
+{
+	if (EquipmentSlots.Slots.Num() == AvailableSlots.Num())
+	{
+		return;
+	}
+
+	EquipmentSlots.Slots.Reset();
+	for (int32 Index = 0; Index < AvailableSlots.Num(); ++Index)
+	{
+		FEquipmentSlot& Slot = EquipmentSlots.Slots.AddDefaulted_GetRef();
+		ApplySlotDefinition(Slot, Index);
+	}
+	RebuildSlotIndex();
+}
+
+void UEquipmentManagerComponent::ApplySlotDefinition(FEquipmentSlot& Slot, int32 DefinitionIndex) const
+{
+	if (!AvailableSlots.IsValidIndex(DefinitionIndex))
+	{
+		return;
 	}
 
+	const FEquipmentSlotDefinition& Def = AvailableSlots[DefinitionIndex];
+	Slot.SlotIndex = static_cast<uint8>(DefinitionIndex);
+	Slot.SlotTag = Def.SlotTag;
+	Slot.AttachSocket = Def.AttachSocket;
+	Slot.AcceptedItemTags = Def.AcceptedItemTags;
+}
+
+void UEquipmentManagerComponent::HandleSlotsReplicated()
+{
+	// Removals are applied after PreReplicatedRemove and adds aren't indexed yet — re-index once
+	// the update is complete, and only if the layout actually changed
+	if (bSlotLayoutDirty || OccupancyMask.Num() != EquipmentSlots.Slots.Num())
+	{
+		bSlotLayoutDirty = false;
+		RebuildSlotIndex();
+	}
+	FlushReplicatedVisualLoads();
 	OnEquipmentChanged.Broadcast();
 }
 
@@ -74,17 +385,24 @@ void UEquipmentManagerComponent::OnRep_EquipmentSlots()
 
 EEquipmentResult UEquipmentManagerComponent::TryEquip(const FItemInstance& Item)
 {
-	FGameplayTag TargetSlot = FindTargetSlot(Item);
+	const FEquipmentResolvedItem Resolved = ResolveItem(Item);
+	FGameplayTag TargetSlot = FindTargetSlot(Resolved);
 	if (!TargetSlot.IsValid())
 	{
 		return EEquipmentResult::IncompatibleSlot;
 	}
-	return TryEquipToSlot(Item, TargetSlot);
+	return TryEquipResolved(Item, Resolved, TargetSlot);
 }
 
 EEquipmentResult UEquipmentManagerComponent::TryEquipToSlot(const FItemInstance& Item, FGameplayTag SlotTag)
 {
-	EEquipmentResult ValidationResult = ValidateEquip(Item, SlotTag);
+	return TryEquipResolved(Item, ResolveItem(Item), SlotTag);
+}
+
+EEquipmentResult UEquipmentManagerComponent::TryEquipResolved(const FItemInstance& Item,
+	const FEquipmentResolvedItem& Resolved, FGameplayTag SlotTag)
+{
+	EEquipmentResult ValidationResult = ValidateEquip(Item, Resolved, SlotTag);
 	if (ValidationResult != EEquipmentResult::Success)
 	{
 		return ValidationResult;
@@ -92,10 +410,25 @@ EEquipmentResult UEquipmentManagerComponent::TryEquipToSlot(const FItemInstance&
 
 	if (GetOwner() && !GetOwner()->HasAuthority())
 	{
-		ServerRPC_RequestEquip(Item, SlotTag);
-		return EEquipmentResult::Success; // Optimistic
+		const uint8 PredictionKey = BeginPrediction();
+		PredictSlotChange(PredictionKey, SlotTag, Item, Resolved);
+
+		// Items the owner's inventory holds go by GUID — the server resolves them itself
+		UInventoryComponent* OwnerInventory = GetOwnerInventory();
+		if (OwnerInventory && OwnerInventory->FindSlotIndexByInstanceId(Item.InstanceId) != INDEX_NONE)
+		{
+			ServerRPC_RequestEquipById(Item.InstanceId, GetNetSlotIndex(SlotTag), PredictionKey);
+		}
+		else
+		{
+			ServerRPC_RequestEquip(Item, SlotTag, PredictionKey);
+		}
+		return EEquipmentResult::Success; // Predicted
 	}
 
+	// Batched so a swap reaches GAS as one change and abilities shared by both items are kept
+	BeginChangeBatch();
+
 	// If slot is occupied, auto-unequip first
 	FEquipmentSlot* Slot = FindSlot(SlotTag);
 	if (Slot && Slot->bIsOccupied)
@@ -103,7 +436,8 @@ EEquipmentResult UEquipmentManagerComponent::TryEquipToSlot(const FItemInstance&
 		Internal_Unequip(SlotTag);
 	}
 
-	Internal_Equip(Item, SlotTag);
+	Internal_Equip(Item, SlotTag, Resolved);
+	EndChangeBatch();
 	return EEquipmentResult::Success;
 }
 
@@ -117,7 +451,10 @@ EEquipmentResult UEquipmentManagerComponent::TryUnequip(FGameplayTag SlotTag, FI
 
 	if (GetOwner() && !GetOwner()->HasAuthority())
 	{
-		ServerRPC_RequestUnequip(SlotTag);
+		OutItem = Slot->EquippedItem;
+		const uint8 PredictionKey = BeginPrediction();
+		PredictSlotChange(PredictionKey, SlotTag, FItemInstance(), FEquipmentResolvedItem());
+		ServerRPC_RequestUnequip(SlotTag, PredictionKey);
 		return EEquipmentResult::Success;
 	}
 
@@ -125,6 +462,48 @@ EEquipmentResult UEquipmentManagerComponent::TryUnequip(FGameplayTag SlotTag, FI
 	return EEquipmentResult::Success;
 }
 
+// ===========================================================================
+// Batch Equip
+// ===========================================================================
+
+EEquipmentResult UEquipmentManagerComponent::TryApplyLoadout(const TArray<FEquipmentLoadoutEntry>& Loadout,
+	TArray<FItemInstance>& OutDisplacedItems)
+{
+	OutDisplacedItems.Reset();
+
+	TArray<FEquipmentResolvedItem> Resolved;
+	EEquipmentResult ValidationResult = ValidateLoadout(Loadout, Resolved);
+	if (ValidationResult != EEquipmentResult::Success)
+	{
+		return ValidationResult;
+	}
+
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		// Predicted — report what the local view displaces, as TryUnequip does
+		for (const FEquipmentLoadoutEntry& Entry : Loadout)
+		{
+			const FEquipmentSlot* Slot = FindSlot(Entry.SlotTag);
+			if (Slot && Slot->bIsOccupied)
+			{
+				OutDisplacedItems.Add(Slot->EquippedItem);
+			}
+		}
+		RemoveReequippedItems(Loadout, OutDisplacedItems);
+
+		const uint8 PredictionKey = BeginPrediction();
+		for (int32 Index = 0; Index < Loadout.Num(); ++Index)
+		{
+			PredictSlotChange(PredictionKey, Loadout[Index].SlotTag, Loadout[Index].Item, Resolved[Index]);
+		}
+		ServerRPC_RequestApplyLoadout(Loadout, PredictionKey);
+		return EEquipmentResult::Success; // Predicted
+	}
+
+	Internal_ApplyLoadout(Loadout, Resolved, OutDisplacedItems);
+	return EEquipmentResult::Success;
+}
+
 // ===========================================================================
 // Inventory-Integrated Equip/Unequip
 // ===========================================================================
@@ -145,18 +524,19 @@ EEquipmentResult UEquipmentManagerComponent::TryEquipFromInventory(const FGuid&
 	}
 
 	FItemInstance Item = SourceInventory->GetItemInSlot(SlotIndex);
+	const FEquipmentResolvedItem Resolved = ResolveItem(Item);
 
 	// Auto-detect slot if not specified
 	if (!SlotTag.IsValid())
 	{
-		SlotTag = FindTargetSlot(Item);
+		SlotTag = FindTargetSlot(Resolved);
 		if (!SlotTag.IsValid())
 		{
 			return EEquipmentResult::IncompatibleSlot;
 		}
 	}
 
-	EEquipmentResult ValidationResult = ValidateEquip(Item, SlotTag);
+	EEquipmentResult ValidationResult = ValidateEquip(Item, Resolved, SlotTag);
 	if (ValidationResult != EEquipmentResult::Success)
 	{
 		return ValidationResult;
@@ -164,10 +544,25 @@ EEquipmentResult UEquipmentManagerComponent::TryEquipFromInventory(const FGuid&
 
 	if (GetOwner() && !GetOwner()->HasAuthority())
 	{
-		ServerRPC_RequestEquipFromInventory(ItemInstanceId, SourceInventory, SlotTag);
+		// Only the slot is predicted — the inventory side follows from inventory replication
+		const uint8 PredictionKey = BeginPrediction();
+		PredictSlotChange(PredictionKey, SlotTag, Item, Resolved);
+
+		if (SourceInventory == GetOwnerInventory())
+		{
+			ServerRPC_RequestEquipFromOwnerInventory(ItemInstanceId, GetNetSlotIndex(SlotTag), PredictionKey);
+		}
+		else
+		{
+			ServerRPC_RequestEquipFromInventory(ItemInstanceId, SourceInventory, SlotTag, PredictionKey);
+		}
 		return EEquipmentResult::Success;
 	}
 
+	// Batched so a swap reaches GAS as one change and abilities shared by both items are kept
+	BeginChangeBatch();
+	ON_SCOPE_EXIT { EndChangeBatch(); };
+
 	// If slot is occupied, check that inventory can accept the old item
 	FEquipmentSlot* ExistingSlot = FindSlot(SlotTag);
 	if (ExistingSlot && ExistingSlot->bIsOccupied)
@@ -178,12 +573,13 @@ EEquipmentResult UEquipmentManagerComponent::TryEquipFromInventory(const FGuid&
 		}
 
 		// Unequip old item back to inventory
+		const FEquipmentResolvedItem OldResolved = ExistingSlot->ResolvedItem;
 		FItemInstance OldItem = Internal_Unequip(SlotTag);
 		EInventoryOperationResult AddResult = SourceInventory->TryAddItem(OldItem);
 		if (AddResult != EInventoryOperationResult::Success)
 		{
 			// Rollback: re-equip old item
-			Internal_Equip(OldItem, SlotTag);
+			Internal_Equip(OldItem, SlotTag, OldResolved);
 			return EEquipmentResult::NoInventorySpace;
 		}
 	}
@@ -195,7 +591,7 @@ EEquipmentResult UEquipmentManagerComponent::TryEquipFromInventory(const FGuid&
 		return EEquipmentResult::Failed;
 	}
 
-	Internal_Equip(Item, SlotTag);
+	Internal_Equip(Item, SlotTag, Resolved);
 	return EEquipmentResult::Success;
 }
 
@@ -220,17 +616,20 @@ EEquipmentResult UEquipmentManagerComponent::TryUnequipToInventory(FGameplayTag
 
 	if (GetOwner() && !GetOwner()->HasAuthority())
 	{
-		ServerRPC_RequestUnequipToInventory(SlotTag, TargetInventory);
+		const uint8 PredictionKey = BeginPrediction();
+		PredictSlotChange(PredictionKey, SlotTag, FItemInstance(), FEquipmentResolvedItem());
+		ServerRPC_RequestUnequipToInventory(SlotTag, TargetInventory, PredictionKey);
 		return EEquipmentResult::Success;
 	}
 
+	const FEquipmentResolvedItem UnequippedResolved = Slot->ResolvedItem;
 	FItemInstance UnequippedItem = Internal_Unequip(SlotTag);
 
 	EInventoryOperationResult AddResult = TargetInventory->TryAddItem(UnequippedItem);
 	if (AddResult != EInventoryOperationResult::Success)
 	{
 		// Rollback: re-equip
-		Internal_Equip(UnequippedItem, SlotTag);
+		Internal_Equip(UnequippedItem, SlotTag, UnequippedResolved);
 		UE_LOG(LogTemp, Error, TEXT("EquipmentManager: Failed to add unequipped item to inventory after validation passed."));
 		return EEquipmentResult::NoInventorySpace;
 	}
@@ -244,54 +643,68 @@ EEquipmentResult UEquipmentManagerComponent::TryUnequipToInventory(FGameplayTag
 
 FItemInstance UEquipmentManagerComponent::GetEquippedItem(FGameplayTag SlotTag) const
 {
-	const FEquipmentSlot* Slot = FindSlot(SlotTag);
-	if (Slot && Slot->bIsOccupied)
-	{
-		return Slot->EquippedItem;
-	}
-	return FItemInstance();
+	const FItemInstance* Item = FindEquippedItem(SlotTag);
+	return Item ? *Item : FItemInstance();
 }
 
 bool UEquipmentManagerComponent::IsSlotOccupied(FGameplayTag SlotTag) const
 {
-	const FEquipmentSlot* Slot = FindSlot(SlotTag);
-	return Slot && Slot->bIsOccupied;
+	const int32 Index = GetSlotIndex(SlotTag);
+	return Index != INDEX_NONE && OccupancyMask.IsValidIndex(Index) && OccupancyMask[Index];
 }
 
 TArray<FGameplayTag> UEquipmentManagerComponent::GetOccupiedSlotTags() const
 {
 	TArray<FGameplayTag> Result;
-	for (const FEquipmentSlot& Slot : EquipmentSlots)
+	ForEachOccupiedSlot([&Result](const FEquipmentSlot& Slot)
 	{
-		if (Slot.bIsOccupied)
-		{
-			Result.Add(Slot.SlotTag);
-		}
-	}
+		Result.Add(Slot.SlotTag);
+	});
 	return Result;
 }
 
 TArray<FGameplayTag> UEquipmentManagerComponent::GetEmptySlotTags() const
 {
 	TArray<FGameplayTag> Result;
-	for (const FEquipmentSlot& Slot : EquipmentSlots)
+	for (int32 Index = 0; Index < OccupancyMask.Num(); ++Index)
 	{
-		if (!Slot.bIsOccupied)
+		if (!OccupancyMask[Index])
 		{
-			Result.Add(Slot.SlotTag);
+			Result.Add(EquipmentSlots.Slots[Index].SlotTag);
 		}
 	}
 	return Result;
 }
 
+const FItemInstance* UEquipmentManagerComponent::FindEquippedItem(FGameplayTag SlotTag) const
+{
+	const int32 Index = GetSlotIndex(SlotTag);
+	if (Index != INDEX_NONE && OccupancyMask.IsValidIndex(Index) && OccupancyMask[Index])
+	{
+		return &EquipmentSlots.Slots[Index].EquippedItem;
+	}
+	return nullptr;
+}
+
+int32 UEquipmentManagerComponent::GetSlotIndex(FGameplayTag SlotTag) const
+{
+	const int32* Index = SlotIndexByTag.Find(SlotTag);
+	if (Index && EquipmentSlots.Slots.IsValidIndex(*Index) && EquipmentSlots.Slots[*Index].SlotTag == SlotTag)
+	{
+		return *Index;
+	}
+	return INDEX_NONE;
+}
+
 bool UEquipmentManagerComponent::CanEquipItem(const FItemInstance& Item) const
 {
-	FGameplayTag TargetSlot = FindTargetSlot(Item);
+	const FEquipmentResolvedItem Resolved = ResolveItem(Item);
+	FGameplayTag TargetSlot = FindTargetSlot(Resolved);
 	if (!TargetSlot.IsValid())
 	{
 		return false;
 	}
-	return ValidateEquip(Item, TargetSlot) == EEquipmentResult::Success;
+	return ValidateEquip(Item, Resolved, TargetSlot) == EEquipmentResult::Success;
 }
 
 // ===========================================================================
@@ -311,73 +724,126 @@ void UEquipmentManagerComponent::OnPostUnequip_Implementation(const FItemInstanc
 // ===========================================================================
 
 void UEquipmentManagerComponent::ServerRPC_RequestEquip_Implementation(const FItemInstance& Item,
-	FGameplayTag SlotTag)
+	FGameplayTag SlotTag, uint8 PredictionKey)
 {
-	EEquipmentResult Result = ValidateEquip(Item, SlotTag);
-	if (Result != EEquipmentResult::Success)
+	RespondToRequest(PredictionKey, Server_Equip(Item, ResolveItem(Item), SlotTag));
+}
+
+void UEquipmentManagerComponent::ServerRPC_RequestUnequip_Implementation(FGameplayTag SlotTag, uint8 PredictionKey)
+{
+	FEquipmentSlot* Slot = FindSlot(SlotTag);
+	if (!Slot || !Slot->bIsOccupied)
 	{
-		ClientRPC_EquipmentOperationFailed(Result);
+		RespondToRequest(PredictionKey, EEquipmentResult::Failed);
 		return;
 	}
 
-	FEquipmentSlot* Slot = FindSlot(SlotTag);
-	if (Slot && Slot->bIsOccupied)
+	Internal_Unequip(SlotTag);
+	RespondToRequest(PredictionKey, EEquipmentResult::Success);
+}
+
+void UEquipmentManagerComponent::ServerRPC_RequestEquipFromInventory_Implementation(const FGuid& ItemInstanceId,
+	UInventoryComponent* SourceInventory, FGameplayTag SlotTag, uint8 PredictionKey)
+{
+	RespondToRequest(PredictionKey, Server_EquipFromInventory(ItemInstanceId, SourceInventory, SlotTag));
+}
+
+void UEquipmentManagerComponent::ServerRPC_RequestEquipFromOwnerInventory_Implementation(const FGuid& ItemInstanceId,
+	uint8 SlotIndex, uint8 PredictionKey)
+{
+	const FGameplayTag SlotTag = GetSlotTagFromNetIndex(SlotIndex);
+	if (SlotIndex != NoSlotIndex && !SlotTag.IsValid())
 	{
-		Internal_Unequip(SlotTag);
+		RespondToRequest(PredictionKey, EEquipmentResult::IncompatibleSlot);
+		return;
 	}
 
-	Internal_Equip(Item, SlotTag);
+	RespondToRequest(PredictionKey, Server_EquipFromInventory(ItemInstanceId, GetOwnerInventory(), SlotTag));
 }
 
-void UEquipmentManagerComponent::ServerRPC_RequestUnequip_Implementation(FGameplayTag SlotTag)
+void UEquipmentManagerComponent::ServerRPC_RequestEquipById_Implementation(const FGuid& ItemInstanceId,
+	uint8 SlotIndex, uint8 PredictionKey)
 {
-	FEquipmentSlot* Slot = FindSlot(SlotTag);
-	if (!Slot || !Slot->bIsOccupied)
+	// Resolve the item server-side — the client only names it
+	UInventoryComponent* OwnerInventory = GetOwnerInventory();
+	const int32 InventoryIndex = OwnerInventory ? OwnerInventory->FindSlotIndexByInstanceId(ItemInstanceId) : INDEX_NONE;
+	if (InventoryIndex == INDEX_NONE)
 	{
-		ClientRPC_EquipmentOperationFailed(EEquipmentResult::Failed);
+		RespondToRequest(PredictionKey, EEquipmentResult::InvalidItem);
 		return;
 	}
 
-	Internal_Unequip(SlotTag);
+	const FItemInstance Item = OwnerInventory->GetItemInSlot(InventoryIndex);
+	const FEquipmentResolvedItem Resolved = ResolveItem(Item);
+
+	FGameplayTag SlotTag = GetSlotTagFromNetIndex(SlotIndex);
+	if (SlotIndex == NoSlotIndex)
+	{
+		SlotTag = FindTargetSlot(Resolved);
+	}
+
+	RespondToRequest(PredictionKey, Server_Equip(Item, Resolved, SlotTag));
 }
 
-void UEquipmentManagerComponent::ServerRPC_RequestEquipFromInventory_Implementation(const FGuid& ItemInstanceId,
+EEquipmentResult UEquipmentManagerComponent::Server_Equip(const FItemInstance& Item,
+	const FEquipmentResolvedItem& Resolved, FGameplayTag SlotTag)
+{
+	EEquipmentResult Result = ValidateEquip(Item, Resolved, SlotTag);
+	if (Result != EEquipmentResult::Success)
+	{
+		return Result;
+	}
+
+	BeginChangeBatch();
+
+	FEquipmentSlot* Slot = FindSlot(SlotTag);
+	if (Slot && Slot->bIsOccupied)
+	{
+		Internal_Unequip(SlotTag);
+	}
+
+	Internal_Equip(Item, SlotTag, Resolved);
+	EndChangeBatch();
+	return EEquipmentResult::Success;
+}
+
+EEquipmentResult UEquipmentManagerComponent::Server_EquipFromInventory(const FGuid& ItemInstanceId,
 	UInventoryComponent* SourceInventory, FGameplayTag SlotTag)
 {
 	if (!SourceInventory)
 	{
-		ClientRPC_EquipmentOperationFailed(EEquipmentResult::Failed);
-		return;
+		return EEquipmentResult::Failed;
 	}
 
 	int32 SlotIndex = SourceInventory->FindSlotIndexByInstanceId(ItemInstanceId);
 	if (SlotIndex == INDEX_NONE)
 	{
-		ClientRPC_EquipmentOperationFailed(EEquipmentResult::InvalidItem);
-		return;
+		return EEquipmentResult::InvalidItem;
 	}
 
 	FItemInstance Item = SourceInventory->GetItemInSlot(SlotIndex);
+	const FEquipmentResolvedItem Resolved = ResolveItem(Item);
 
 	if (!SlotTag.IsValid())
 	{
-		SlotTag = FindTargetSlot(Item);
+		SlotTag = FindTargetSlot(Resolved);
 	}
 
-	EEquipmentResult Result = ValidateEquip(Item, SlotTag);
+	EEquipmentResult Result = ValidateEquip(Item, Resolved, SlotTag);
 	if (Result != EEquipmentResult::Success)
 	{
-		ClientRPC_EquipmentOperationFailed(Result);
-		return;
+		return Result;
 	}
 
+	BeginChangeBatch();
+	ON_SCOPE_EXIT { EndChangeBatch(); };
+
 	FEquipmentSlot* ExistingSlot = FindSlot(SlotTag);
 	if (ExistingSlot && ExistingSlot->bIsOccupied)
 	{
 		if (!SourceInventory->CanAcceptItem(ExistingSlot->EquippedItem))
 		{
-			ClientRPC_EquipmentOperationFailed(EEquipmentResult::NoInventorySpace);
-			return;
+			return EEquipmentResult::NoInventorySpace;
 		}
 
 		FItemInstance OldItem = Internal_Unequip(SlotTag);
@@ -385,97 +851,239 @@ void UEquipmentManagerComponent::ServerRPC_RequestEquipFromInventory_Implementat
 	}
 
 	SourceInventory->TryRemoveItem(ItemInstanceId);
-	Internal_Equip(Item, SlotTag);
+	Internal_Equip(Item, SlotTag, Resolved);
+	return EEquipmentResult::Success;
 }
 
 void UEquipmentManagerComponent::ServerRPC_RequestUnequipToInventory_Implementation(FGameplayTag SlotTag,
-	UInventoryComponent* TargetInventory)
+	UInventoryComponent* TargetInventory, uint8 PredictionKey)
 {
 	if (!TargetInventory)
 	{
-		ClientRPC_EquipmentOperationFailed(EEquipmentResult::Failed);
+		RespondToRequest(PredictionKey, EEquipmentResult::Failed);
 		return;
 	}
 
 	FEquipmentSlot* Slot = FindSlot(SlotTag);
 	if (!Slot || !Slot->bIsOccupied)
 	{
-		ClientRPC_EquipmentOperationFailed(EEquipmentResult::Failed);
+		RespondToRequest(PredictionKey, EEquipmentResult::Failed);
 		return;
 	}
 
 	if (!TargetInventory->CanAcceptItem(Slot->EquippedItem))
 	{
-		ClientRPC_EquipmentOperationFailed(EEquipmentResult::NoInventorySpace);
+		RespondToRequest(PredictionKey, EEquipmentResult::NoInventorySpace);
 		return;
 	}
 
 	FItemInstance UnequippedItem = Internal_Unequip(SlotTag);
 	TargetInventory->TryAddItem(UnequippedItem);
+	RespondToRequest(PredictionKey, EEquipmentResult::Success);
 }
 
-// ===========================================================================
-// Client RPC
+void UEquipmentManagerComponent::ServerRPC_RequestApplyLoadout_Implementation(
+	const TArray<FEquipmentLoadoutEntry>& Loadout, uint8 PredictionKey)
+{
+	TArray<FEquipmentResolvedItem> Resolved;
+	const EEquipmentResult Result = ValidateLoadout(Loadout, Resolved);
+	if (Result == EEquipmentResult::Success)
+	{
+		// The requesting client already has its displaced items from its own prediction
+		TArray<FItemInstance> DisplacedItems;
+		Internal_ApplyLoadout(Loadout, Resolved, DisplacedItems);
+	}
+
+	RespondToRequest(PredictionKey, Result);
+}
+
+void UEquipmentManagerComponent::RespondToRequest(uint8 PredictionKey, EEquipmentResult Result)
+{
+	if (Result != EEquipmentResult::Success)
+	{
+		ClientRPC_EquipmentOperationFailed(Result, PredictionKey);
+	}
+	else if (PredictionKey != NoPredictionKey)
+	{
+		ClientRPC_ConfirmPrediction(PredictionKey);
+	}
+}
+
+// ===========================================================================
+// Client RPC
 // ===========================================================================
 
-void UEquipmentManagerComponent::ClientRPC_EquipmentOperationFailed_Implementation(EEquipmentResult Result)
+void UEquipmentManagerComponent::ClientRPC_EquipmentOperationFailed_Implementation(EEquipmentResult Result,
+	uint8 PredictionKey)
 {
+	RollbackPrediction(PredictionKey);
 	OnOperationFailed.Broadcast(Result);
 }
 
+void UEquipmentManagerComponent::ClientRPC_ConfirmPrediction_Implementation(uint8 PredictionKey)
+{
+	PendingPredictions.RemoveAll([PredictionKey](const FPredictedSlotChange& Change)
+	{
+		return Change.PredictionKey == PredictionKey;
+	});
+}
+
 // ===========================================================================
-// Slot Finding & Validation
+// Client Prediction
 // ===========================================================================
 
-FGameplayTag UEquipmentManagerComponent::FindTargetSlot(const FItemInstance& Item) const
+uint8 UEquipmentManagerComponent::BeginPrediction()
 {
-	UItemFragment_Equipment* EquipFrag = GetEquipmentFragment(Item);
-	if (!EquipFrag || !EquipFrag->EquipmentSlotTag.IsValid())
+	if (!bPredictClientChanges)
 	{
-		return FGameplayTag();
+		return NoPredictionKey;
 	}
 
-	FGameplayTag PreferredTag = EquipFrag->EquipmentSlotTag;
+	LastPredictionKey = LastPredictionKey == MAX_uint8 ? 1 : LastPredictionKey + 1;
+	return LastPredictionKey;
+}
 
-	// Exact match: find empty slot with this tag
-	for (const FEquipmentSlot& Slot : EquipmentSlots)
+void UEquipmentManagerComponent::PredictSlotChange(uint8 PredictionKey, FGameplayTag SlotTag,
+	const FItemInstance& Item, const FEquipmentResolvedItem& Resolved)
+{
+	if (PredictionKey == NoPredictionKey)
 	{
-		if (Slot.SlotTag == PreferredTag && !Slot.bIsOccupied)
-		{
-			return Slot.SlotTag;
-		}
+		return;
+	}
+
+	const int32 SlotArrayIndex = GetSlotIndex(SlotTag);
+	if (SlotArrayIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FEquipmentSlot& Slot = EquipmentSlots.Slots[SlotArrayIndex];
+
+	FPredictedSlotChange& Change = PendingPredictions.AddDefaulted_GetRef();
+	Change.PredictionKey = PredictionKey;
+	Change.SlotArrayIndex = SlotArrayIndex;
+	Change.PreviousItem = Slot.bIsOccupied ? Slot.EquippedItem : FItemInstance();
+	Change.PreviousResolved = Slot.ResolvedItem;
+
+	SetSlotLocal(Slot, Item, Resolved);
+}
+
+void UEquipmentManagerComponent::RollbackPrediction(uint8 PredictionKey)
+{
+	if (PredictionKey == NoPredictionKey)
+	{
+		return;
+	}
+
+	const int32 FirstIndex = PendingPredictions.IndexOfByPredicate([PredictionKey](const FPredictedSlotChange& Change)
+	{
+		return Change.PredictionKey == PredictionKey;
+	});
+	if (FirstIndex == INDEX_NONE)
+	{
+		return;
 	}
 
-	// Parent tag match: find first empty child slot
-	for (const FEquipmentSlot& Slot : EquipmentSlots)
+	// Later predictions were built on top of this one — unwind newest first back to it
+	for (int32 Index = PendingPredictions.Num() - 1; Index >= FirstIndex; --Index)
 	{
-		if (Slot.SlotTag.MatchesTag(PreferredTag) && !Slot.bIsOccupied)
+		const FPredictedSlotChange& Change = PendingPredictions[Index];
+		if (EquipmentSlots.Slots.IsValidIndex(Change.SlotArrayIndex))
 		{
-			return Slot.SlotTag;
+			SetSlotLocal(EquipmentSlots.Slots[Change.SlotArrayIndex], Change.PreviousItem, Change.PreviousResolved);
 		}
 	}
+	PendingPredictions.SetNum(FirstIndex);
+}
+
+void UEquipmentManagerComponent::SetSlotLocal(FEquipmentSlot& Slot, const FItemInstance& Item,
+	const FEquipmentResolvedItem& Resolved)
+{
+	// Remove while still occupied so linked anim layers are unlinked
+	if (Slot.bIsOccupied)
+	{
+		RemoveVisuals(Slot.SlotTag);
+	}
 
-	// All matching slots occupied — return first match (will trigger swap)
-	for (const FEquipmentSlot& Slot : EquipmentSlots)
+	Slot.EquippedItem = Item;
+	Slot.bIsOccupied = Item.IsValid();
+	Slot.ResolvedItem = Slot.bIsOccupied ? Resolved : FEquipmentResolvedItem();
+	UpdateOccupancyBit(Slot.SlotTag);
+
+	if (Slot.bIsOccupied)
+	{
+		ApplyVisuals(Slot.SlotTag);
+	}
+
+	NotifyEquipmentChanged(Slot.SlotTag);
+}
+
+// ===========================================================================
+// Slot Finding & Validation
+// ===========================================================================
+
+uint8 UEquipmentManagerComponent::GetNetSlotIndex(FGameplayTag SlotTag) const
+{
+	const FEquipmentSlot* Slot = SlotTag.IsValid() ? FindSlot(SlotTag) : nullptr;
+	return Slot ? Slot->SlotIndex : NoSlotIndex;
+}
+
+FGameplayTag UEquipmentManagerComponent::GetSlotTagFromNetIndex(uint8 SlotIndex) const
+{
+	// Server slots are in AvailableSlots order, so the definition index is the array index
+	if (SlotIndex != NoSlotIndex && EquipmentSlots.Slots.IsValidIndex(SlotIndex))
+	{
+		return EquipmentSlots.Slots[SlotIndex].SlotTag;
+	}
+	return FGameplayTag();
+}
+
+FGameplayTag UEquipmentManagerComponent::FindTargetSlot(const FItemInstance& Item) const
+{
+	return FindTargetSlot(ResolveItem(Item));
+}
+
+FGameplayTag UEquipmentManagerComponent::FindTargetSlot(const FEquipmentResolvedItem& Resolved) const
+{
+	const UItemFragment_Equipment* EquipFrag = Resolved.EquipmentFragment;
+	if (!EquipFrag || !EquipFrag->EquipmentSlotTag.IsValid())
+	{
+		return FGameplayTag();
+	}
+
+	const FSlotCandidates* Candidates = SlotCandidatesByTag.Find(EquipFrag->EquipmentSlotTag);
+	if (!Candidates)
+	{
+		return FGameplayTag();
+	}
+
+	// Exact match first, then child slots — take the first empty one
+	for (int32 Index : Candidates->Ordered)
 	{
-		if (Slot.SlotTag == PreferredTag || Slot.SlotTag.MatchesTag(PreferredTag))
+		if (!OccupancyMask[Index])
 		{
-			return Slot.SlotTag;
+			return EquipmentSlots.Slots[Index].SlotTag;
 		}
 	}
 
-	return FGameplayTag();
+	// All matching slots occupied — return first match (will trigger swap)
+	return EquipmentSlots.Slots[Candidates->Fallback].SlotTag;
 }
 
 EEquipmentResult UEquipmentManagerComponent::ValidateEquip(const FItemInstance& Item, FGameplayTag SlotTag) const
+{
+	return ValidateEquip(Item, ResolveItem(Item), SlotTag);
+}
+
+EEquipmentResult UEquipmentManagerComponent::ValidateEquip(const FItemInstance& Item,
+	const FEquipmentResolvedItem& Resolved, FGameplayTag SlotTag) const
 {
 	if (!Item.IsValid())
 	{
 		return EEquipmentResult::InvalidItem;
 	}
 
-	UItemFragment_Equipment* EquipFrag = GetEquipmentFragment(Item);
-	if (!EquipFrag)
+	if (!Resolved.IsValid())
 	{
 		return EEquipmentResult::InvalidItem;
 	}
@@ -489,13 +1097,72 @@ EEquipmentResult UEquipmentManagerComponent::ValidateEquip(const FItemInstance&
 	// Check accepted item tags (if any are configured)
 	if (Slot->AcceptedItemTags.Num() > 0)
 	{
-		UItemDatabaseSubsystem* DB = GetItemDatabase();
-		if (DB)
+		const UItemDefinition* Def = Resolved.Definition;
+		if (Def && !Def->ItemTags.HasAny(Slot->AcceptedItemTags))
+		{
+			return EEquipmentResult::IncompatibleSlot;
+		}
+	}
+
+	return EEquipmentResult::Success;
+}
+
+EEquipmentResult UEquipmentManagerComponent::ValidateLoadout(const TArray<FEquipmentLoadoutEntry>& Loadout,
+	TArray<FEquipmentResolvedItem>& OutResolved) const
+{
+	TSet<FGameplayTag> SeenSlots;
+	SeenSlots.Reserve(Loadout.Num());
+	TSet<FGuid> SeenInstanceIds;
+	SeenInstanceIds.Reserve(Loadout.Num());
+
+	for (const FEquipmentLoadoutEntry& Entry : Loadout)
+	{
+		if (!FindSlot(Entry.SlotTag))
+		{
+			return EEquipmentResult::IncompatibleSlot;
+		}
+
+		// Each slot may appear only once — otherwise the result would depend on entry order
+		bool bAlreadySeen = false;
+		SeenSlots.Add(Entry.SlotTag, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			return EEquipmentResult::Failed;
+		}
+
+		// Each item may appear only once — equipping it twice would duplicate it
+		if (Entry.Item.IsValid())
+		{
+			SeenInstanceIds.Add(Entry.Item.InstanceId, &bAlreadySeen);
+			if (bAlreadySeen)
+			{
+				return EEquipmentResult::Failed;
+			}
+		}
+	}
+
+	// A listed item may move out of a slot the loadout clears or replaces, but not out of one it leaves alone
+	for (const FEquipmentSlot& Slot : EquipmentSlots.Slots)
+	{
+		if (Slot.bIsOccupied && !SeenSlots.Contains(Slot.SlotTag)
+			&& SeenInstanceIds.Contains(Slot.EquippedItem.InstanceId))
+		{
+			return EEquipmentResult::SlotOccupied;
+		}
+	}
+
+	OutResolved.Reset(Loadout.Num());
+
+	for (const FEquipmentLoadoutEntry& Entry : Loadout)
+	{
+		FEquipmentResolvedItem& Resolved = OutResolved.AddDefaulted_GetRef();
+		if (Entry.Item.IsValid())
 		{
-			UItemDefinition* Def = DB->GetDefinition(Item.ItemDefinitionId);
-			if (Def && !Def->ItemTags.HasAny(Slot->AcceptedItemTags))
+			Resolved = ResolveItem(Entry.Item);
+			EEquipmentResult Result = ValidateEquip(Entry.Item, Resolved, Entry.SlotTag);
+			if (Result != EEquipmentResult::Success)
 			{
-				return EEquipmentResult::IncompatibleSlot;
+				return Result;
 			}
 		}
 	}
@@ -507,23 +1174,67 @@ EEquipmentResult UEquipmentManagerComponent::ValidateEquip(const FItemInstance&
 // Internal Equip/Unequip
 // ===========================================================================
 
-void UEquipmentManagerComponent::Internal_Equip(const FItemInstance& Item, FGameplayTag SlotTag)
+void UEquipmentManagerComponent::Internal_ApplyLoadout(const TArray<FEquipmentLoadoutEntry>& Loadout,
+	const TArray<FEquipmentResolvedItem>& Resolved, TArray<FItemInstance>& OutDisplacedItems)
+{
+	BeginChangeBatch();
+
+	// ValidateLoadout guarantees every slot exists, so neither call below can fail part-way
+	for (int32 Index = 0; Index < Loadout.Num(); ++Index)
+	{
+		const FEquipmentLoadoutEntry& Entry = Loadout[Index];
+		FItemInstance Displaced = Internal_Unequip(Entry.SlotTag);
+		if (Displaced.IsValid())
+		{
+			OutDisplacedItems.Add(MoveTemp(Displaced));
+		}
+
+		if (Entry.Item.IsValid())
+		{
+			Internal_Equip(Entry.Item, Entry.SlotTag, Resolved[Index]);
+		}
+	}
+
+	EndChangeBatch();
+
+	RemoveReequippedItems(Loadout, OutDisplacedItems);
+}
+
+void UEquipmentManagerComponent::RemoveReequippedItems(const TArray<FEquipmentLoadoutEntry>& Loadout,
+	TArray<FItemInstance>& DisplacedItems)
+{
+	// An item the loadout only moves to another slot is still equipped — it was not displaced
+	DisplacedItems.RemoveAll([&Loadout](const FItemInstance& Item)
+	{
+		return Loadout.ContainsByPredicate([&Item](const FEquipmentLoadoutEntry& Entry)
+		{
+			return Entry.Item.IsValid() && Entry.Item.InstanceId == Item.InstanceId;
+		});
+	});
+}
+
+bool UEquipmentManagerComponent::Internal_Equip(const FItemInstance& Item, FGameplayTag SlotTag,
+	const FEquipmentResolvedItem& Resolved)
 {
 	FEquipmentSlot* Slot = FindSlot(SlotTag);
 	if (!Slot)
 	{
-		return;
+		return false;
 	}
 
 	Slot->EquippedItem = Item;
 	Slot->bIsOccupied = true;
+	Slot->ResolvedItem = Resolved;
+	MarkSlotDirty(*Slot);
+	UpdateOccupancyBit(SlotTag);
 
-	ApplyVisuals(Item, SlotTag);
-	ApplyGAS(Item, SlotTag);
+	ApplyVisuals(SlotTag);
+	ApplyGAS(Item, SlotTag, Resolved.EquipmentFragment);
 
 	OnItemEquipped.Broadcast(Item, SlotTag);
-	OnEquipmentChanged.Broadcast();
+	NotifyEquipmentChanged(SlotTag);
 	OnPostEquip(Item, SlotTag);
+	return true;
 }
 
 FItemInstance UEquipmentManagerComponent::Internal_Unequip(FGameplayTag SlotTag)
@@ -541,9 +1252,12 @@ FItemInstance UEquipmentManagerComponent::Internal_Unequip(FGameplayTag SlotTag)
 
 	Slot->EquippedItem = FItemInstance();
 	Slot->bIsOccupied = false;
+	Slot->ResolvedItem.Reset();
+	MarkSlotDirty(*Slot);
+	UpdateOccupancyBit(SlotTag);
 
 	OnItemUnequipped.Broadcast(UnequippedItem, SlotTag);
-	OnEquipmentChanged.Broadcast();
+	NotifyEquipmentChanged(SlotTag);
 	OnPostUnequip(UnequippedItem, SlotTag);
 
 	return UnequippedItem;
@@ -555,48 +1269,142 @@ FItemInstance UEquipmentManagerComponent::Internal_Unequip(FGameplayTag SlotTag)
 
 FEquipmentSlot* UEquipmentManagerComponent::FindSlot(FGameplayTag SlotTag)
 {
-	for (FEquipmentSlot& Slot : EquipmentSlots)
+	const int32 Index = GetSlotIndex(SlotTag);
+	return Index != INDEX_NONE ? &EquipmentSlots.Slots[Index] : nullptr;
+}
+
+const FEquipmentSlot* UEquipmentManagerComponent::FindSlot(FGameplayTag SlotTag) const
+{
+	const int32 Index = GetSlotIndex(SlotTag);
+	return Index != INDEX_NONE ? &EquipmentSlots.Slots[Index] : nullptr;
+}
+
+const FEquipmentSlotDefinition* UEquipmentManagerComponent::FindSlotDefinition(FGameplayTag SlotTag) const
+{
+	const int32* Index = DefinitionIndexByTag.Find(SlotTag);
+	if (Index && AvailableSlots.IsValidIndex(*Index))
 	{
-		if (Slot.SlotTag == SlotTag)
-		{
-			return &Slot;
-		}
+		return &AvailableSlots[*Index];
 	}
 	return nullptr;
 }
 
-const FEquipmentSlot* UEquipmentManagerComponent::FindSlot(FGameplayTag SlotTag) const
+void UEquipmentManagerComponent::RebuildSlotIndex()
 {
-	for (const FEquipmentSlot& Slot : EquipmentSlots)
+	SlotIndexByTag.Reset();
+	for (int32 Index = 0; Index < EquipmentSlots.Slots.Num(); ++Index)
 	{
-		if (Slot.SlotTag == SlotTag)
+		// First slot wins on duplicate tags, matching the previous linear scan
+		if (!SlotIndexByTag.Contains(EquipmentSlots.Slots[Index].SlotTag))
 		{
-			return &Slot;
+			SlotIndexByTag.Add(EquipmentSlots.Slots[Index].SlotTag, Index);
+		}
+	}
+
+	OccupancyMask.Init(false, EquipmentSlots.Slots.Num());
+	for (int32 Index = 0; Index < EquipmentSlots.Slots.Num(); ++Index)
+	{
+		OccupancyMask[Index] = EquipmentSlots.Slots[Index].bIsOccupied;
+	}
+
+	// Compile the auto-slotting table: exact-tag slots first, then slots whose tag is a child
+	// of the key. Replaces per-item MatchesTag hierarchy walks in FindTargetSlot.
+	SlotCandidatesByTag.Reset();
+	for (int32 Index = 0; Index < EquipmentSlots.Slots.Num(); ++Index)
+	{
+		const FGameplayTag& SlotTag = EquipmentSlots.Slots[Index].SlotTag;
+		if (SlotTag.IsValid())
+		{
+			SlotCandidatesByTag.FindOrAdd(SlotTag).Ordered.Add(Index);
+		}
+	}
+	for (int32 Index = 0; Index < EquipmentSlots.Slots.Num(); ++Index)
+	{
+		const FGameplayTag& SlotTag = EquipmentSlots.Slots[Index].SlotTag;
+		if (!SlotTag.IsValid())
+		{
+			continue;
+		}
+
+		for (const FGameplayTag& ParentTag : SlotTag.GetGameplayTagParents())
+		{
+			FSlotCandidates& Candidates = SlotCandidatesByTag.FindOrAdd(ParentTag);
+			if (ParentTag != SlotTag)
+			{
+				Candidates.Ordered.Add(Index);
+			}
+			if (Candidates.Fallback == INDEX_NONE)
+			{
+				Candidates.Fallback = Index;
+			}
+		}
+	}
+
+	DefinitionIndexByTag.Reset();
+	for (int32 Index = 0; Index < AvailableSlots.Num(); ++Index)
+	{
+		if (!DefinitionIndexByTag.Contains(AvailableSlots[Index].SlotTag))
+		{
+			DefinitionIndexByTag.Add(AvailableSlots[Index].SlotTag, Index);
+		}
+	}
+
+	VisualSettingsIndexByTag.Reset();
+	for (int32 Index = 0; Index < SlotVisualSettings.Num(); ++Index)
+	{
+		if (!VisualSettingsIndexByTag.Contains(SlotVisualSettings[Index].SlotTag))
+		{
+			VisualSettingsIndexByTag.Add(SlotVisualSettings[Index].SlotTag, Index);
 		}
 	}
-	return nullptr;
 }
 
-const FEquipmentSlotDefinition* UEquipmentManagerComponent::FindSlotDefinition(FGameplayTag SlotTag) const
+void UEquipmentManagerComponent::MarkSlotDirty(FEquipmentSlot& Slot)
 {
-	for (const FEquipmentSlotDefinition& Def : AvailableSlots)
+	EquipmentSlots.MarkItemDirty(Slot);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UEquipmentManagerComponent, EquipmentSlots, this);
+
+	if (VisualSlots.Items.IsValidIndex(Slot.SlotIndex))
 	{
-		if (Def.SlotTag == SlotTag)
+		FEquipmentVisualSlot& Record = VisualSlots.Items[Slot.SlotIndex];
+		const FPrimaryAssetId NewDefinitionId = Slot.bIsOccupied ? Slot.EquippedItem.ItemDefinitionId : FPrimaryAssetId();
+		if (Record.ItemDefinitionId != NewDefinitionId)
 		{
-			return &Def;
+			Record.ItemDefinitionId = NewDefinitionId;
+			VisualSlots.MarkItemDirty(Record);
+			MARK_PROPERTY_DIRTY_FROM_NAME(UEquipmentManagerComponent, VisualSlots, this);
 		}
 	}
-	return nullptr;
+}
+
+void UEquipmentManagerComponent::UpdateOccupancyBit(FGameplayTag SlotTag)
+{
+	const int32 Index = GetSlotIndex(SlotTag);
+	if (Index != INDEX_NONE && OccupancyMask.IsValidIndex(Index))
+	{
+		OccupancyMask[Index] = EquipmentSlots.Slots[Index].bIsOccupied;
+	}
 }
 
 // ===========================================================================
 // Visuals
 // ===========================================================================
 
-void UEquipmentManagerComponent::ApplyVisuals(const FItemInstance& Item, FGameplayTag SlotTag)
+void UEquipmentManagerComponent::ApplyVisuals(FGameplayTag SlotTag)
 {
-	UItemFragment_Equipment* EquipFrag = GetEquipmentFragment(Item);
-	if (!EquipFrag)
+	if (!AreVisualsEnabled())
+	{
+		return;
+	}
+
+	FEquipmentSlot* Slot = FindSlot(SlotTag);
+	if (!Slot)
+	{
+		return;
+	}
+
+	const UItemFragment_Equipment* EquipFrag = Slot->ResolvedItem.EquipmentFragment;
+	if (!EquipFrag || !ShouldSlotHaveVisual(*Slot))
 	{
 		return;
 	}
@@ -619,17 +1427,8 @@ void UEquipmentManagerComponent::ApplyVisuals(const FItemInstance& Item, FGamepl
 		return; // No visual — ability-only equipment
 	}
 
-	FEquipmentSlot* Slot = FindSlot(SlotTag);
-	if (!Slot)
-	{
-		return;
-	}
-
 	// Cancel any pending load
-	if (Slot->MeshLoadHandle.IsValid())
-	{
-		Slot->MeshLoadHandle->CancelHandle();
-	}
+	ReleaseMeshLoadHandle(*Slot);
 
 	FStreamableManager& Manager = UAssetManager::GetStreamableManager();
 	Slot->MeshLoadHandle = Manager.RequestAsyncLoad(
@@ -640,63 +1439,99 @@ void UEquipmentManagerComponent::ApplyVisuals(const FItemInstance& Item, FGamepl
 
 void UEquipmentManagerComponent::OnMeshLoaded(FGameplayTag SlotTag)
 {
+	if (!AreVisualsEnabled())
+	{
+		return;
+	}
+
+	// Component creation/registration is the expensive part — spread it over frames with every other manager
+	UEquipmentVisualSubsystem* VisualSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UEquipmentVisualSubsystem>() : nullptr;
+	if (VisualSubsystem)
+	{
+		VisualSubsystem->QueueAttachment(this, SlotTag);
+	}
+	else
+	{
+		AttachLoadedVisual(SlotTag);
+	}
+}
+
+void UEquipmentManagerComponent::AttachLoadedVisual(FGameplayTag SlotTag)
+{
+	if (!AreVisualsEnabled())
+	{
+		return;
+	}
+
+	// The slot may have been emptied, or the tier dropped, while the attachment was queued
 	FEquipmentSlot* Slot = FindSlot(SlotTag);
-	if (!Slot || !Slot->bIsOccupied)
+	if (!Slot || !Slot->bIsOccupied || !ShouldSlotHaveVisual(*Slot))
 	{
 		return;
 	}
 
-	UItemFragment_Equipment* EquipFrag = GetEquipmentFragment(Slot->EquippedItem);
+	const UItemFragment_Equipment* EquipFrag = Slot->ResolvedItem.EquipmentFragment;
 	if (!EquipFrag)
 	{
 		return;
 	}
 
+	// Only a finished load for the current item may replace what is shown — a released, cancelled or
+	// superseded handle (the slot changed item since this was queued) leaves the old visual in place
+	const TSharedPtr<FStreamableHandle>& LoadHandle = Slot->MeshLoadHandle;
+	if (!LoadHandle.IsValid() || !LoadHandle->HasLoadCompleted() || LoadHandle->WasCanceled())
+	{
+		return;
+	}
+
+	const bool bIsSkeletal = !EquipFrag->EquipSkeletalMesh.IsNull();
+	USkeletalMesh* SkelMesh = bIsSkeletal ? EquipFrag->EquipSkeletalMesh.Get() : nullptr;
+	UStaticMesh* StaticMesh = bIsSkeletal ? nullptr : EquipFrag->EquipMesh.Get();
+	if (!SkelMesh && !StaticMesh)
+	{
+		return;
+	}
+
 	USkeletalMeshComponent* OwnerMesh = GetOwnerMesh();
 	if (!OwnerMesh)
 	{
 		return;
 	}
 
-	// Remove old visual if any
+	// Return the old visual to the pool — the acquire below usually hands the same component straight back
 	if (Slot->AttachedVisualComponent)
 	{
-		Slot->AttachedVisualComponent->DestroyComponent();
+		ReleaseVisualComponent(Slot->AttachedVisualComponent);
 		Slot->AttachedVisualComponent = nullptr;
 	}
 
-	FName Socket = Slot->AttachSocket;
+	const FName Socket = Slot->AttachSocket;
 
-	if (!EquipFrag->EquipSkeletalMesh.IsNull())
+	if (SkelMesh && bMergeSkeletalEquipment)
 	{
-		USkeletalMesh* SkelMesh = EquipFrag->EquipSkeletalMesh.Get();
-		if (SkelMesh)
-		{
-			USkeletalMeshComponent* SkelComp = NewObject<USkeletalMeshComponent>(GetOwner());
-			SkelComp->SetSkeletalMesh(SkelMesh);
-			SkelComp->AttachToComponent(OwnerMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale, Socket);
-			SkelComp->RegisterComponent();
-			Slot->AttachedVisualComponent = SkelComp;
-		}
+		// Becomes part of the owner mesh once every pending load has finished
+		ScheduleMeshMerge();
 	}
-	else if (!EquipFrag->EquipMesh.IsNull())
+	else if (SkelMesh)
 	{
-		UStaticMesh* StaticMesh = EquipFrag->EquipMesh.Get();
-		if (StaticMesh)
-		{
-			UStaticMeshComponent* StaticComp = NewObject<UStaticMeshComponent>(GetOwner());
-			StaticComp->SetStaticMesh(StaticMesh);
-			StaticComp->AttachToComponent(OwnerMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale, Socket);
-			StaticComp->RegisterComponent();
-			Slot->AttachedVisualComponent = StaticComp;
-		}
+		// A leader-posed piece takes its bone transforms in the owner's component space — attached at a socket
+		// it would be offset by the socket a second time, so it always sits on the owner mesh root
+		const FEquipmentSlotVisualSettings* Settings = FindSlotVisualSettings(SlotTag);
+		const bool bLeaderPose = Settings && Settings->PoseMode == EEquipmentPoseMode::LeaderPose;
+		USkeletalMeshComponent* SkelComp = AcquireSkeletalMeshComponent(OwnerMesh, bLeaderPose ? NAME_None : Socket);
+		SkelComp->SetSkeletalMesh(SkelMesh);
+		ApplyPoseMode(SkelComp, OwnerMesh, SlotTag);
+		Slot->AttachedVisualComponent = SkelComp;
 	}
-
-	// Animation layer support
-	if (EquipFrag->AnimLayerClass)
+	else
 	{
-		OwnerMesh->LinkAnimClassLayers(EquipFrag->AnimLayerClass);
+		UStaticMeshComponent* StaticComp = AcquireStaticMeshComponent(OwnerMesh, Socket);
+		StaticComp->SetStaticMesh(StaticMesh);
+		Slot->AttachedVisualComponent = StaticComp;
 	}
+
+	// Animation layer support — ref-counted, linked in the next batched flush (full detail only)
+	SetSlotAnimLayer(*Slot, VisualLOD == EEquipmentVisualLOD::Full ? EquipFrag->AnimLayerClass : nullptr);
 }
 
 void UEquipmentManagerComponent::RemoveVisuals(FGameplayTag SlotTag)
@@ -708,47 +1543,771 @@ void UEquipmentManagerComponent::RemoveVisuals(FGameplayTag SlotTag)
 	}
 
 	// Cancel pending mesh load
-	if (Slot->MeshLoadHandle.IsValid())
-	{
-		Slot->MeshLoadHandle->CancelHandle();
-		Slot->MeshLoadHandle.Reset();
-	}
+	ReleaseMeshLoadHandle(*Slot);
 
 	if (Slot->AttachedVisualComponent)
 	{
-		Slot->AttachedVisualComponent->DestroyComponent();
+		ReleaseVisualComponent(Slot->AttachedVisualComponent);
 		Slot->AttachedVisualComponent = nullptr;
 	}
 
-	// Unlink animation layers if applicable
-	if (Slot->bIsOccupied)
+	// Keyed on the outgoing item, not occupancy — replicated unequips clear bIsOccupied before this runs
+	const UItemFragment_Equipment* OutgoingFrag = Slot->ResolvedItem.EquipmentFragment;
+	if (bMergeSkeletalEquipment && OutgoingFrag && !OutgoingFrag->EquipSkeletalMesh.IsNull())
 	{
-		UItemFragment_Equipment* EquipFrag = GetEquipmentFragment(Slot->EquippedItem);
-		if (EquipFrag && EquipFrag->AnimLayerClass)
-		{
-			USkeletalMeshComponent* OwnerMesh = GetOwnerMesh();
-			if (OwnerMesh)
-			{
-				OwnerMesh->UnlinkAnimClassLayers(EquipFrag->AnimLayerClass);
-			}
-		}
+		ScheduleMeshMerge();
 	}
+
+	// Release the slot's anim layer — only unlinked once no other slot uses the class
+	SetSlotAnimLayer(*Slot, nullptr);
 }
 
-USkeletalMeshComponent* UEquipmentManagerComponent::GetOwnerMesh() const
+bool UEquipmentManagerComponent::AreVisualsEnabled() const
 {
-	if (!GetOwner())
+	return bApplyVisualsOnDedicatedServer || GetNetMode() != NM_DedicatedServer;
+}
+
+bool UEquipmentManagerComponent::ShouldSlotHaveVisual(const FEquipmentSlot& Slot) const
+{
+	switch (VisualLOD)
+	{
+	case EEquipmentVisualLOD::Full:
+		return true;
+
+	case EEquipmentVisualLOD::Reduced:
+	{
+		// Merged skeletal pieces cost no extra component — keep the merged mesh
+		const UItemFragment_Equipment* EquipFrag = Slot.ResolvedItem.EquipmentFragment;
+		if (bMergeSkeletalEquipment && EquipFrag && !EquipFrag->EquipSkeletalMesh.IsNull())
+		{
+			return true;
+		}
+		const FEquipmentSlotVisualSettings* Settings = FindSlotVisualSettings(Slot.SlotTag);
+		return Settings && Settings->bKeepAtReducedLOD;
+	}
+
+	default:
+		return false;
+	}
+}
+
+void UEquipmentManagerComponent::SetVisualLOD(EEquipmentVisualLOD NewLOD)
+{
+	if (VisualLOD == NewLOD)
+	{
+		return;
+	}
+	VisualLOD = NewLOD;
+
+	const int32 NumPooledStatic = PooledStaticMeshComponents.Num();
+	const int32 NumPooledSkeletal = PooledSkeletalMeshComponents.Num();
+
+	for (FEquipmentSlot& Slot : EquipmentSlots.Slots)
+	{
+		if (!Slot.bIsOccupied)
+		{
+			continue;
+		}
+
+		// A kept load handle means the visual is loaded or loading (merged pieces have no component)
+		const bool bHasVisual = Slot.AttachedVisualComponent || Slot.MeshLoadHandle.IsValid();
+		const bool bWantsVisual = ShouldSlotHaveVisual(Slot);
+
+		if (bHasVisual && !bWantsVisual)
+		{
+			RemoveVisuals(Slot.SlotTag);
+		}
+		else if (!bHasVisual && bWantsVisual)
+		{
+			ApplyVisuals(Slot.SlotTag);
+		}
+		else if (bHasVisual)
+		{
+			const UItemFragment_Equipment* EquipFrag = Slot.ResolvedItem.EquipmentFragment;
+			SetSlotAnimLayer(Slot, EquipFrag && VisualLOD == EEquipmentVisualLOD::Full ? EquipFrag->AnimLayerClass : nullptr);
+		}
+	}
+
+	// Pooled components stay registered and attached — don't keep the ones this tier stopped using.
+	// None shows nothing, so its pool is emptied entirely.
+	if (VisualLOD == EEquipmentVisualLOD::None)
+	{
+		TrimVisualComponentPool(0, 0);
+	}
+	else if (VisualLOD == EEquipmentVisualLOD::Reduced)
+	{
+		TrimVisualComponentPool(NumPooledStatic, NumPooledSkeletal);
+	}
+}
+
+// ===========================================================================
+// Owner Bindings
+// ===========================================================================
+
+USkeletalMeshComponent* UEquipmentManagerComponent::GetOwnerMesh() const
+{
+	// Only a found component is cached — a missing one (e.g. before possession) is looked up again next call
+	if (USkeletalMeshComponent* Cached = CachedOwnerMesh.Get())
+	{
+		return Cached;
+	}
+
+	AActor* Owner = GetOwner();
+	if (!Owner)
 	{
 		return nullptr;
 	}
-	return GetOwner()->FindComponentByClass<USkeletalMeshComponent>();
+
+	USkeletalMeshComponent* OwnerMesh = Cast<USkeletalMeshComponent>(OwnerMeshReference.GetComponent(Owner));
+	if (!OwnerMesh)
+	{
+		OwnerMesh = Owner->FindComponentByClass<USkeletalMeshComponent>();
+	}
+
+	CachedOwnerMesh = OwnerMesh;
+	return OwnerMesh;
+}
+
+UActorComponent* UEquipmentManagerComponent::GetAbilitySystemBinding(TSubclassOf<UActorComponent> ComponentClass) const
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !ComponentClass)
+	{
+		return nullptr;
+	}
+
+	// Cached per requested class — a lookup for another class must not be answered by this one
+	UActorComponent* Cached = CachedAbilitySystem.Get();
+	if (Cached && CachedAbilitySystemClass.Get() == ComponentClass.Get())
+	{
+		return Cached;
+	}
+
+	UActorComponent* AbilitySystem = AbilitySystemReference.GetComponent(Owner);
+	if (!AbilitySystem || !AbilitySystem->IsA(ComponentClass))
+	{
+		AbilitySystem = Owner->FindComponentByClass(ComponentClass);
+	}
+
+	// Only a found component is cached — one added later (e.g. on a player state at possession) is still picked up
+	if (AbilitySystem)
+	{
+		CachedAbilitySystem = AbilitySystem;
+		CachedAbilitySystemClass = ComponentClass.Get();
+	}
+	return AbilitySystem;
+}
+
+void UEquipmentManagerComponent::InvalidateOwnerBindings()
+{
+	CachedOwnerMesh.Reset();
+	CachedAbilitySystem.Reset();
+	CachedAbilitySystemClass.Reset();
+	CachedOwnerInventory.Reset();
+}
+
+void UEquipmentManagerComponent::SetOwnerMeshReference(const FComponentReference& NewReference)
+{
+	OwnerMeshReference = NewReference;
+	CachedOwnerMesh.Reset();
+}
+
+void UEquipmentManagerComponent::SetAbilitySystemReference(const FComponentReference& NewReference)
+{
+	AbilitySystemReference = NewReference;
+	CachedAbilitySystem.Reset();
+	CachedAbilitySystemClass.Reset();
+}
+
+void UEquipmentManagerComponent::HandleOwnerControllerChanged(APawn* Pawn, AController* OldController,
+	AController* NewController)
+{
+	InvalidateOwnerBindings();
+}
+
+// ===========================================================================
+// Anim Layers
+// ===========================================================================
+
+void UEquipmentManagerComponent::SetSlotAnimLayer(FEquipmentSlot& Slot, TSubclassOf<UAnimInstance> LayerClass)
+{
+	if (Slot.LinkedAnimLayerClass == LayerClass)
+	{
+		return;
+	}
+
+	bool bLinkSetChanged = false;
+
+	if (Slot.LinkedAnimLayerClass)
+	{
+		int32& RefCount = AnimLayerRefCounts.FindOrAdd(Slot.LinkedAnimLayerClass);
+		if (--RefCount <= 0)
+		{
+			AnimLayerRefCounts.Remove(Slot.LinkedAnimLayerClass);
+			bLinkSetChanged = true;
+		}
+	}
+
+	Slot.LinkedAnimLayerClass = LayerClass;
+
+	if (LayerClass)
+	{
+		int32& RefCount = AnimLayerRefCounts.FindOrAdd(LayerClass);
+		bLinkSetChanged |= ++RefCount == 1;
+	}
+
+	if (!bLinkSetChanged || bAnimLayerFlushScheduled)
+	{
+		return;
+	}
+
+	// Every link/unlink reinitializes layer instances — a swap's unlink + link lands in one flush
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		FlushAnimLayers();
+		return;
+	}
+
+	bAnimLayerFlushScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &UEquipmentManagerComponent::FlushAnimLayers));
+}
+
+void UEquipmentManagerComponent::FlushAnimLayers()
+{
+	bAnimLayerFlushScheduled = false;
+
+	USkeletalMeshComponent* OwnerMesh = GetOwnerMesh();
+	if (!OwnerMesh)
+	{
+		return;
+	}
+
+	for (int32 Index = LinkedAnimLayers.Num() - 1; Index >= 0; --Index)
+	{
+		if (!AnimLayerRefCounts.Contains(LinkedAnimLayers[Index]))
+		{
+			OwnerMesh->UnlinkAnimClassLayers(LinkedAnimLayers[Index]);
+			LinkedAnimLayers.RemoveAt(Index);
+		}
+	}
+
+	for (const TPair<TSubclassOf<UAnimInstance>, int32>& Pair : AnimLayerRefCounts)
+	{
+		if (!LinkedAnimLayers.Contains(Pair.Key))
+		{
+			OwnerMesh->LinkAnimClassLayers(Pair.Key);
+			LinkedAnimLayers.Add(Pair.Key);
+		}
+	}
+}
+
+// ===========================================================================
+// Batched Replication Loads
+// ===========================================================================
+
+void UEquipmentManagerComponent::FlushReplicatedVisualLoads()
+{
+	if (PendingReplicatedVisualSlots.Num() == 0)
+	{
+		return;
+	}
+
+	// Icons only matter to the owning player's UI
+	const bool bIncludeIcons = GetOwnerRole() == ROLE_AutonomousProxy;
+
+	TArray<FSoftObjectPath> AssetPaths;
+	TArray<FGameplayTag> BatchedSlotTags;
+	for (const FGameplayTag& SlotTag : PendingReplicatedVisualSlots)
+	{
+		FEquipmentSlot* Slot = FindSlot(SlotTag);
+		const UItemFragment_Equipment* EquipFrag = Slot && Slot->bIsOccupied ? Slot->ResolvedItem.EquipmentFragment.Get() : nullptr;
+		if (!EquipFrag || !ShouldSlotHaveVisual(*Slot))
+		{
+			continue;
+		}
+
+		// Anim layer classes are hard references — already loaded with the fragment
+		const FSoftObjectPath MeshPath = !EquipFrag->EquipSkeletalMesh.IsNull()
+			? EquipFrag->EquipSkeletalMesh.ToSoftObjectPath()
+			: EquipFrag->EquipMesh.ToSoftObjectPath();
+		if (MeshPath.IsNull())
+		{
+			continue;
+		}
+
+		ReleaseMeshLoadHandle(*Slot);
+		AssetPaths.AddUnique(MeshPath);
+		BatchedSlotTags.Add(SlotTag);
+
+		const UItemDefinition* Def = Slot->ResolvedItem.Definition;
+		if (bIncludeIcons && Def && !Def->Icon.IsNull())
+		{
+			AssetPaths.AddUnique(Def->Icon.ToSoftObjectPath());
+		}
+	}
+	PendingReplicatedVisualSlots.Reset();
+
+	if (BatchedSlotTags.Num() == 0)
+	{
+		return;
+	}
+
+	// One handle for the whole update, shared by every slot in it — keeps the assets alive like a per-slot handle
+	FStreamableManager& Manager = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> BatchHandle = Manager.RequestAsyncLoad(
+		MoveTemp(AssetPaths),
+		FStreamableDelegate(),
+		GetVisualLoadPriority()
+	);
+
+	for (const FGameplayTag& SlotTag : BatchedSlotTags)
+	{
+		if (FEquipmentSlot* Slot = FindSlot(SlotTag))
+		{
+			Slot->MeshLoadHandle = BatchHandle;
+		}
+	}
+
+	// Bound after the slots hold the handle so the callback can tell which slots still belong to this batch
+	const FStreamableDelegate OnLoaded = FStreamableDelegate::CreateUObject(
+		this, &UEquipmentManagerComponent::OnReplicatedVisualsLoaded, BatchedSlotTags, TWeakPtr<FStreamableHandle>(BatchHandle));
+	if (!BatchHandle.IsValid() || !BatchHandle->BindCompleteDelegate(OnLoaded))
+	{
+		// Already loaded (or nothing to load) — the handle completed synchronously
+		OnLoaded.Execute();
+	}
+}
+
+void UEquipmentManagerComponent::OnReplicatedVisualsLoaded(TArray<FGameplayTag> SlotTags,
+	TWeakPtr<FStreamableHandle> BatchHandle)
+{
+	const TSharedPtr<FStreamableHandle> Handle = BatchHandle.Pin();
+	for (const FGameplayTag& SlotTag : SlotTags)
+	{
+		// Slots that changed item or were cleared since the batch was issued no longer hold its handle
+		const FEquipmentSlot* Slot = FindSlot(SlotTag);
+		if (!Slot || Slot->MeshLoadHandle != Handle)
+		{
+			continue;
+		}
+		OnMeshLoaded(SlotTag);
+	}
+}
+
+TAsyncLoadPriority UEquipmentManagerComponent::GetVisualLoadPriority() const
+{
+	const UWorld* World = GetWorld();
+	const APlayerController* LocalPC = UEquipmentVisualSubsystem::FindLocalPlayerController(World);
+	if (!LocalPC || !GetOwner())
+	{
+		return FStreamableManager::DefaultAsyncLoadPriority;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	LocalPC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const float Distance = FVector::Dist(ViewLocation, GetOwner()->GetActorLocation());
+	const float Alpha = FMath::Clamp(Distance / FMath::Max(VisualLoadPriorityDistance, 1.f), 0.f, 1.f);
+	return FMath::RoundToInt(FMath::Lerp(
+		static_cast<float>(FStreamableManager::AsyncLoadHighPriority),
+		static_cast<float>(FStreamableManager::DefaultAsyncLoadPriority),
+		Alpha));
+}
+
+void UEquipmentManagerComponent::ReleaseMeshLoadHandle(FEquipmentSlot& Slot)
+{
+	if (!Slot.MeshLoadHandle.IsValid())
+	{
+		return;
+	}
+
+	const bool bShared = EquipmentSlots.Slots.ContainsByPredicate([&Slot](const FEquipmentSlot& Other)
+	{
+		return &Other != &Slot && Other.MeshLoadHandle == Slot.MeshLoadHandle;
+	});
+	if (!bShared)
+	{
+		Slot.MeshLoadHandle->CancelHandle();
+	}
+	Slot.MeshLoadHandle.Reset();
+}
+
+// ===========================================================================
+// Skeletal Mesh Merging
+// ===========================================================================
+
+void UEquipmentManagerComponent::ScheduleMeshMerge()
+{
+	if (bMeshMergeScheduled || !AreVisualsEnabled())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		RebuildMergedMesh();
+		return;
+	}
+
+	// Next tick — an unequip runs before its slot is cleared, and a swap's new load starts after it
+	bMeshMergeScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &UEquipmentManagerComponent::RebuildMergedMesh));
+}
+
+void UEquipmentManagerComponent::RebuildMergedMesh()
+{
+	bMeshMergeScheduled = false;
+
+	USkeletalMeshComponent* OwnerMesh = GetOwnerMesh();
+	if (!OwnerMesh)
+	{
+		return;
+	}
+
+	if (!UnmergedBodyMesh)
+	{
+		UnmergedBodyMesh = OwnerMesh->GetSkeletalMeshAsset();
+		if (!UnmergedBodyMesh)
+		{
+			return;
+		}
+	}
+
+	TArray<USkeletalMesh*> SourceMeshes;
+	SourceMeshes.Add(UnmergedBodyMesh);
+
+	for (const FEquipmentSlot& Slot : EquipmentSlots.Slots)
+	{
+		// Pieces hidden by the current visual tier are left out of the merge like any other visual
+		const UItemFragment_Equipment* EquipFrag = Slot.ResolvedItem.EquipmentFragment;
+		if (!Slot.bIsOccupied || !EquipFrag || EquipFrag->EquipSkeletalMesh.IsNull() || !ShouldSlotHaveVisual(Slot))
+		{
+			continue;
+		}
+
+		// Still loading — OnMeshLoaded schedules another merge when it lands
+		if (Slot.MeshLoadHandle.IsValid() && !Slot.MeshLoadHandle->HasLoadCompleted())
+		{
+			return;
+		}
+
+		if (USkeletalMesh* SkelMesh = EquipFrag->EquipSkeletalMesh.Get())
+		{
+			SourceMeshes.Add(SkelMesh);
+		}
+	}
+
+	USkeletalMesh* TargetMesh = UnmergedBodyMesh;
+	if (SourceMeshes.Num() > 1)
+	{
+		UEquipmentMeshMergeSubsystem* MergeCache = GetWorld() ? GetWorld()->GetSubsystem<UEquipmentMeshMergeSubsystem>() : nullptr;
+		USkeletalMesh* MergedMesh = MergeCache ? MergeCache->FindOrMerge(SourceMeshes, UnmergedBodyMesh->GetSkeleton()) : nullptr;
+		if (MergedMesh)
+		{
+			TargetMesh = MergedMesh;
+		}
+	}
+
+	if (OwnerMesh->GetSkeletalMeshAsset() != TargetMesh)
+	{
+		OwnerMesh->SetSkeletalMesh(TargetMesh, /*bReinitPose=*/ false);
+	}
+}
+
+// ===========================================================================
+// Visual Component Pool
+// ===========================================================================
+
+UStaticMeshComponent* UEquipmentManagerComponent::AcquireStaticMeshComponent(USkeletalMeshComponent* OwnerMesh,
+	FName Socket)
+{
+	UStaticMeshComponent* Comp = PooledStaticMeshComponents.Num() > 0 ? PooledStaticMeshComponents.Pop() : nullptr;
+	if (!Comp || !IsValid(Comp))
+	{
+		Comp = NewObject<UStaticMeshComponent>(GetOwner());
+		Comp->AttachToComponent(OwnerMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale, Socket);
+		Comp->RegisterComponent();
+		return Comp;
+	}
+
+	// Already registered — only the attachment and visibility change
+	Comp->AttachToComponent(OwnerMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale, Socket);
+	Comp->SetVisibility(true);
+	return Comp;
+}
+
+USkeletalMeshComponent* UEquipmentManagerComponent::AcquireSkeletalMeshComponent(USkeletalMeshComponent* OwnerMesh,
+	FName Socket)
+{
+	USkeletalMeshComponent* Comp = PooledSkeletalMeshComponents.Num() > 0 ? PooledSkeletalMeshComponents.Pop() : nullptr;
+	if (!Comp || !IsValid(Comp))
+	{
+		Comp = NewObject<USkeletalMeshComponent>(GetOwner());
+		Comp->AttachToComponent(OwnerMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale, Socket);
+		Comp->RegisterComponent();
+		return Comp;
+	}
+
+	Comp->AttachToComponent(OwnerMesh, FAttachmentTransformRules::SnapToTargetNotIncludingScale, Socket);
+	Comp->SetVisibility(true);
+	return Comp;
+}
+
+void UEquipmentManagerComponent::ApplyPoseMode(USkeletalMeshComponent* SkelComp, USkeletalMeshComponent* OwnerMesh,
+	FGameplayTag SlotTag) const
+{
+	const FEquipmentSlotVisualSettings* Settings = FindSlotVisualSettings(SlotTag);
+	const EEquipmentPoseMode PoseMode = Settings ? Settings->PoseMode : EEquipmentPoseMode::Independent;
+
+	switch (PoseMode)
+	{
+	case EEquipmentPoseMode::LeaderPose:
+		// Bone transforms come straight from the owner mesh — no anim instance, no evaluation
+		SkelComp->SetAnimInstanceClass(nullptr);
+		SkelComp->SetLeaderPoseComponent(OwnerMesh);
+		break;
+
+	case EEquipmentPoseMode::CopyPose:
+		SkelComp->SetLeaderPoseComponent(nullptr);
+		SkelComp->SetAnimInstanceClass(Settings->CopyPoseAnimClass);
+		break;
+
+	default:
+		SkelComp->SetLeaderPoseComponent(nullptr);
+		SkelComp->SetAnimInstanceClass(nullptr);
+		break;
+	}
+}
+
+const FEquipmentSlotVisualSettings* UEquipmentManagerComponent::FindSlotVisualSettings(FGameplayTag SlotTag) const
+{
+	const int32* Index = VisualSettingsIndexByTag.Find(SlotTag);
+	return Index ? &SlotVisualSettings[*Index] : nullptr;
+}
+
+void UEquipmentManagerComponent::ReleaseVisualComponent(USceneComponent* Component)
+{
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	// Clear the mesh so the pooled component doesn't keep the asset loaded
+	if (UStaticMeshComponent* StaticComp = Cast<UStaticMeshComponent>(Component))
+	{
+		if (PooledStaticMeshComponents.Num() < MaxPooledVisualComponents)
+		{
+			StaticComp->SetVisibility(false);
+			StaticComp->SetStaticMesh(nullptr);
+			PooledStaticMeshComponents.Add(StaticComp);
+			return;
+		}
+	}
+	else if (USkeletalMeshComponent* SkelComp = Cast<USkeletalMeshComponent>(Component))
+	{
+		if (PooledSkeletalMeshComponents.Num() < MaxPooledVisualComponents)
+		{
+			SkelComp->SetVisibility(false);
+			SkelComp->SetLeaderPoseComponent(nullptr);
+			SkelComp->SetSkeletalMesh(nullptr);
+			PooledSkeletalMeshComponents.Add(SkelComp);
+			return;
+		}
+	}
+
+	Component->DestroyComponent();
+}
+
+void UEquipmentManagerComponent::TrimVisualComponentPool(int32 MaxStatic, int32 MaxSkeletal)
+{
+	while (PooledStaticMeshComponents.Num() > MaxStatic)
+	{
+		UStaticMeshComponent* Comp = PooledStaticMeshComponents.Pop();
+		if (IsValid(Comp))
+		{
+			Comp->DestroyComponent();
+		}
+	}
+
+	while (PooledSkeletalMeshComponents.Num() > MaxSkeletal)
+	{
+		USkeletalMeshComponent* Comp = PooledSkeletalMeshComponents.Pop();
+		if (IsValid(Comp))
+		{
+			Comp->DestroyComponent();
+		}
+	}
+}
+
+// ===========================================================================
+// Change Batching
+// ===========================================================================
+
+void UEquipmentManagerComponent::BeginChangeBatch()
+{
+	++ChangeBatchDepth;
+}
+
+void UEquipmentManagerComponent::EndChangeBatch()
+{
+	check(ChangeBatchDepth > 0);
+	if (--ChangeBatchDepth > 0)
+	{
+		return;
+	}
+
+	FlushPendingGAS();
+
+	if (bChangedDuringBatch)
+	{
+		bChangedDuringBatch = false;
+		OnEquipmentChanged.Broadcast();
+	}
+}
+
+void UEquipmentManagerComponent::NotifyEquipmentChanged(FGameplayTag SlotTag)
+{
+	MarkSlotChanged(GetSlotIndex(SlotTag));
+
+	if (ChangeBatchDepth > 0)
+	{
+		bChangedDuringBatch = true;
+		return;
+	}
+	OnEquipmentChanged.Broadcast();
+}
+
+void UEquipmentManagerComponent::MarkSlotChanged(int32 SlotArrayIndex)
+{
+	if (SlotArrayIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (PendingChangedSlots.Num() < EquipmentSlots.Slots.Num())
+	{
+		PendingChangedSlots.Add(false, EquipmentSlots.Slots.Num() - PendingChangedSlots.Num());
+	}
+	PendingChangedSlots[SlotArrayIndex] = true;
+
+	if (bSlotChangeFlushScheduled)
+	{
+		return;
+	}
+
+	// Without a world (e.g. automation tests) there is no frame to coalesce into
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		FlushSlotChanges();
+		return;
+	}
+
+	bSlotChangeFlushScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &UEquipmentManagerComponent::FlushSlotChanges));
+}
+
+void UEquipmentManagerComponent::FlushSlotChanges()
+{
+	bSlotChangeFlushScheduled = false;
+
+	// Listeners may change equipment — anything they change lands in the next flush
+	TBitArray<> ChangedSlots = MoveTemp(PendingChangedSlots);
+	PendingChangedSlots.Reset();
+
+	if (ChangedSlots.Find(true) == INDEX_NONE)
+	{
+		return;
+	}
+
+	OnEquipmentSlotsChanged.Broadcast(ChangedSlots);
+
+	// TBitArray can't cross into Blueprint — only build the tag list when someone listens
+	if (OnEquipmentSlotTagsChanged.IsBound())
+	{
+		TArray<FGameplayTag> ChangedSlotTags;
+		for (TConstSetBitIterator<> It(ChangedSlots); It; ++It)
+		{
+			if (EquipmentSlots.Slots.IsValidIndex(It.GetIndex()))
+			{
+				ChangedSlotTags.Add(EquipmentSlots.Slots[It.GetIndex()].SlotTag);
+			}
+		}
+		OnEquipmentSlotTagsChanged.Broadcast(ChangedSlotTags);
+	}
+}
+
+UEquipmentManagerComponent::FPendingGASChange& UEquipmentManagerComponent::FindOrAddPendingGAS(FGameplayTag SlotTag)
+{
+	// Batches touch a handful of slots — a linear scan beats hashing here
+	for (FPendingGASChange& Change : PendingGASChanges)
+	{
+		if (Change.SlotTag == SlotTag)
+		{
+			return Change;
+		}
+	}
+
+	FPendingGASChange& Change = PendingGASChanges.AddDefaulted_GetRef();
+	Change.SlotTag = SlotTag;
+	return Change;
+}
+
+void UEquipmentManagerComponent::FlushPendingGAS()
+{
+	if (PendingGASChanges.Num() == 0)
+	{
+		return;
+	}
+
+	// Move out first — callbacks may start new batches
+	TArray<FPendingGASChange> Changes = MoveTemp(PendingGASChanges);
+	PendingGASChanges.Reset();
+
+	// A slot both revoked and granted is a swap — handed over whole so shared grants survive
+	const auto IsSwap = [this](const FPendingGASChange& Change)
+	{
+		return Change.bRevoke && Change.bGrant && OnGASSwapCallback;
+	};
+
+	for (const FPendingGASChange& Change : Changes)
+	{
+		if (Change.bRevoke && !IsSwap(Change) && OnGASUnequipCallback)
+		{
+			OnGASUnequipCallback(Change.SlotTag);
+		}
+	}
+
+	for (const FPendingGASChange& Change : Changes)
+	{
+		if (IsSwap(Change))
+		{
+			OnGASSwapCallback(Change.GrantItem, Change.SlotTag, Change.GrantFragment);
+		}
+		else if (Change.bGrant && OnGASEquipCallback)
+		{
+			OnGASEquipCallback(Change.GrantItem, Change.SlotTag, Change.GrantFragment);
+		}
+	}
+
+	if (OnGASCommitCallback)
+	{
+		OnGASCommitCallback();
+	}
 }
 
 // ===========================================================================
 // GAS Helpers
 // ===========================================================================
 
-void UEquipmentManagerComponent::ApplyGAS(const FItemInstance& Item, FGameplayTag SlotTag)
+void UEquipmentManagerComponent::ApplyGAS(const FItemInstance& Item, FGameplayTag SlotTag,
+	UItemFragment_Equipment* EquipFrag)
 {
 	// Server-only — ASC replication handles clients
 	if (GetOwner() && !GetOwner()->HasAuthority())
@@ -756,9 +2315,23 @@ void UEquipmentManagerComponent::ApplyGAS(const FItemInstance& Item, FGameplayTa
 		return;
 	}
 
+	if (ChangeBatchDepth > 0)
+	{
+		FPendingGASChange& Change = FindOrAddPendingGAS(SlotTag);
+		Change.GrantItem = Item;
+		Change.GrantFragment = EquipFrag;
+		Change.bGrant = true;
+		return;
+	}
+
 	if (OnGASEquipCallback)
 	{
-		OnGASEquipCallback(Item, SlotTag);
+		OnGASEquipCallback(Item, SlotTag, EquipFrag);
+	}
+
+	if (OnGASCommitCallback)
+	{
+		OnGASCommitCallback();
 	}
 }
 
@@ -769,16 +2342,47 @@ void UEquipmentManagerComponent::RemoveGAS(FGameplayTag SlotTag)
 		return;
 	}
 
+	if (ChangeBatchDepth > 0)
+	{
+		FPendingGASChange& Change = FindOrAddPendingGAS(SlotTag);
+		if (Change.bGrant)
+		{
+			// Granted earlier in this batch — never reached the ASC, so just drop the grant
+			Change.bGrant = false;
+			Change.GrantItem = FItemInstance();
+			Change.GrantFragment = nullptr;
+		}
+		else
+		{
+			Change.bRevoke = true;
+		}
+		return;
+	}
+
 	if (OnGASUnequipCallback)
 	{
 		OnGASUnequipCallback(SlotTag);
 	}
+
+	if (OnGASCommitCallback)
+	{
+		OnGASCommitCallback();
+	}
 }
 
 // ===========================================================================
 // Helpers
 // ===========================================================================
 
+UInventoryComponent* UEquipmentManagerComponent::GetOwnerInventory() const
+{
+	if (!CachedOwnerInventory.IsValid() && GetOwner())
+	{
+		CachedOwnerInventory = GetOwner()->FindComponentByClass<UInventoryComponent>();
+	}
+	return CachedOwnerInventory.Get();
+}
+
 UItemDatabaseSubsystem* UEquipmentManagerComponent::GetItemDatabase() const
 {
 	if (!CachedItemDatabase)
@@ -792,19 +2396,20 @@ UItemDatabaseSubsystem* UEquipmentManagerComponent::GetItemDatabase() const
 	return CachedItemDatabase;
 }
 
-UItemFragment_Equipment* UEquipmentManagerComponent::GetEquipmentFragment(const FItemInstance& Item) const
+FEquipmentResolvedItem UEquipmentManagerComponent::ResolveItem(const FItemInstance& Item) const
 {
+	FEquipmentResolvedItem Resolved;
+
 	UItemDatabaseSubsystem* DB = GetItemDatabase();
 	if (!DB)
 	{
-		return nullptr;
+		return Resolved;
 	}
 
-	UItemDefinition* Def = DB->GetDefinition(Item.ItemDefinitionId);
-	if (!Def)
+	Resolved.Definition = DB->GetDefinition(Item.ItemDefinitionId);
+	if (Resolved.Definition)
 	{
-		return nullptr;
+		Resolved.EquipmentFragment = Resolved.Definition->FindFragment<UItemFragment_Equipment>();
 	}
-
-	return Def->FindFragment<UItemFragment_Equipment>();
+	return Resolved;
 }
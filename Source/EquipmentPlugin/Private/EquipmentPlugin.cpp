@@ -6,6 +6,11 @@
 #include "GameplayTagsManager.h"
 
 #include "Components/EquipmentManagerComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/SkeletalMesh.h"
+#include "UObject/UObjectIterator.h"
 #include "Subsystems/ItemDatabaseSubsystem.h"
 #include "Data/ItemDefinition.h"
 #include "Types/CGFItemTypes.h"
@@ -109,6 +114,57 @@ void FEquipmentPluginModule::StartupModule()
 				UE_LOG(LogTemp, Log, TEXT("Equipment.UnequipAll: Unequipped %d item(s)."), Unequipped);
 			})
 	));
+
+	// Equipment.VisualStats
+	ConsoleCommands.Add(MakeUnique<FAutoConsoleCommandWithWorldAndArgs>(
+		TEXT("Equipment.VisualStats"),
+		TEXT("Log equipment visual cost in this world: components, pending loads and resident equipment mesh memory."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args, UWorld* World)
+			{
+				int32 Managers = 0;
+				int32 VisualsDisabled = 0;
+				int32 Components = 0;
+				int32 PendingLoads = 0;
+				TSet<const UObject*> Meshes;
+
+				for (TObjectIterator<UEquipmentManagerComponent> It; It; ++It)
+				{
+					if (It->GetWorld() != World)
+					{
+						continue;
+					}
+
+					++Managers;
+					VisualsDisabled += It->AreVisualsEnabled() ? 0 : 1;
+
+					for (const FEquipmentSlot& Slot : It->GetSlots())
+					{
+						PendingLoads += Slot.MeshLoadHandle.IsValid() && Slot.MeshLoadHandle->IsLoadingInProgress() ? 1 : 0;
+
+						if (const UStaticMeshComponent* StaticComp = Cast<UStaticMeshComponent>(Slot.AttachedVisualComponent))
+						{
+							++Components;
+							Meshes.Add(StaticComp->GetStaticMesh());
+						}
+						else if (const USkeletalMeshComponent* SkelComp = Cast<USkeletalMeshComponent>(Slot.AttachedVisualComponent))
+						{
+							++Components;
+							Meshes.Add(SkelComp->GetSkeletalMeshAsset());
+						}
+					}
+				}
+
+				SIZE_T MeshBytes = 0;
+				for (const UObject* Mesh : Meshes)
+				{
+					MeshBytes += Mesh ? Mesh->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal) : 0;
+				}
+
+				UE_LOG(LogTemp, Log, TEXT("Equipment.VisualStats: %d manager(s) (%d with visuals disabled), %d visual component(s), %d pending load(s), %d unique mesh(es), %.2f MB"),
+					Managers, VisualsDisabled, Components, PendingLoads, Meshes.Num(), MeshBytes / (1024.0 * 1024.0));
+			})
+	));
 }
 
 void FEquipmentPluginModule::ShutdownModule()
@@ -0,0 +1,96 @@
+#include "Subsystems/EquipmentMeshMergeSubsystem.h"
+#include "Engine/SkeletalMesh.h"
+#include "Animation/Skeleton.h"
+#include "SkeletalMeshMerge.h"
+
+USkeletalMesh* UEquipmentMeshMergeSubsystem::FindOrMerge(const TArray<USkeletalMesh*>& SourceMeshes,
+	USkeleton* Skeleton)
+{
+	if (SourceMeshes.Num() == 0 || !Skeleton)
+	{
+		return nullptr;
+	}
+
+	const uint32 Hash = HashSourceMeshes(SourceMeshes);
+
+	TArray<FMergedMeshEntry*> Candidates;
+	MergedMeshes.MultiFindPointer(Hash, Candidates);
+	for (FMergedMeshEntry* Entry : Candidates)
+	{
+		if (Entry->MergedMesh.IsValid() && Entry->Matches(SourceMeshes))
+		{
+			return Entry->MergedMesh.Get();
+		}
+	}
+
+	// Every miss inserts — prune the whole cache here so loadouts nobody wears any more don't pile up
+	PruneExpiredEntries();
+
+	USkeletalMesh* MergedMesh = NewObject<USkeletalMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	MergedMesh->SetSkeleton(Skeleton);
+
+	const TArray<FSkelMeshMergeSectionMapping> SectionMappings;
+	FSkeletalMeshMerge Merger(MergedMesh, SourceMeshes, SectionMappings, 0);
+	if (!Merger.DoMerge())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("EquipmentMeshMerge: Failed to merge %d equipment meshes."), SourceMeshes.Num());
+		return nullptr;
+	}
+
+	FMergedMeshEntry Entry;
+	Entry.SourceMeshes.Reserve(SourceMeshes.Num());
+	for (USkeletalMesh* Source : SourceMeshes)
+	{
+		Entry.SourceMeshes.Add(Source);
+	}
+	Entry.MergedMesh = MergedMesh;
+	MergedMeshes.Add(Hash, MoveTemp(Entry));
+
+	return MergedMesh;
+}
+
+void UEquipmentMeshMergeSubsystem::PruneExpiredEntries()
+{
+	for (auto It = MergedMeshes.CreateIterator(); It; ++It)
+	{
+		const FMergedMeshEntry& Entry = It.Value();
+		const bool bSourceCollected = Entry.SourceMeshes.ContainsByPredicate([](const TWeakObjectPtr<USkeletalMesh>& Source)
+		{
+			return !Source.IsValid();
+		});
+
+		// A collected source can never match again, even if its merged mesh is still in use
+		if (!Entry.MergedMesh.IsValid() || bSourceCollected)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+uint32 UEquipmentMeshMergeSubsystem::HashSourceMeshes(const TArray<USkeletalMesh*>& SourceMeshes)
+{
+	// Order matters — the body is first and section order follows the list
+	uint32 Hash = 0;
+	for (const USkeletalMesh* Source : SourceMeshes)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Source));
+	}
+	return Hash;
+}
+
+bool UEquipmentMeshMergeSubsystem::FMergedMeshEntry::Matches(const TArray<USkeletalMesh*>& InSourceMeshes) const
+{
+	if (SourceMeshes.Num() != InSourceMeshes.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < SourceMeshes.Num(); ++Index)
+	{
+		if (SourceMeshes[Index].Get() != InSourceMeshes[Index])
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,232 @@
+#include "Subsystems/EquipmentVisualSubsystem.h"
+#include "Components/EquipmentManagerComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarEquipmentVisualAttachBudgetMs(
+	TEXT("Equipment.VisualAttachBudgetMs"),
+	1.0f,
+	TEXT("Per-frame time budget (ms) for attaching loaded equipment visuals across all managers in a world. ")
+	TEXT("At least one attachment is made per frame. <= 0 attaches everything immediately."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEquipmentVisualLODReducedDistance(
+	TEXT("Equipment.VisualLOD.ReducedDistance"),
+	3000.f,
+	TEXT("Distance (cm) from the local view beyond which equipment drops to the Reduced visual tier."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEquipmentVisualLODNoneDistance(
+	TEXT("Equipment.VisualLOD.NoneDistance"),
+	8000.f,
+	TEXT("Distance (cm) from the local view beyond which equipment has no visual components."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEquipmentVisualLODHysteresis(
+	TEXT("Equipment.VisualLOD.Hysteresis"),
+	250.f,
+	TEXT("Distance (cm) past a tier boundary an actor must move before its tier changes, so actors on a boundary don't flip every update."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEquipmentVisualLODUpdateInterval(
+	TEXT("Equipment.VisualLOD.UpdateInterval"),
+	0.25f,
+	TEXT("Seconds between equipment visual LOD re-evaluations."),
+	ECVF_Default);
+
+void UEquipmentVisualSubsystem::QueueAttachment(UEquipmentManagerComponent* Manager, FGameplayTag SlotTag)
+{
+	if (!Manager)
+	{
+		return;
+	}
+
+	if (CVarEquipmentVisualAttachBudgetMs.GetValueOnGameThread() <= 0.f)
+	{
+		Manager->AttachLoadedVisual(SlotTag);
+		return;
+	}
+
+	const bool bAlreadyQueued = PendingAttachments.ContainsByPredicate([Manager, SlotTag](const FPendingAttachment& Pending)
+	{
+		return Pending.Manager.Get() == Manager && Pending.SlotTag == SlotTag;
+	});
+	if (bAlreadyQueued)
+	{
+		return;
+	}
+
+	FPendingAttachment& Pending = PendingAttachments.AddDefaulted_GetRef();
+	Pending.Manager = Manager;
+	Pending.SlotTag = SlotTag;
+}
+
+void UEquipmentVisualSubsystem::RegisterForVisualLOD(UEquipmentManagerComponent* Manager)
+{
+	if (Manager)
+	{
+		LODManagers.AddUnique(Manager);
+	}
+}
+
+void UEquipmentVisualSubsystem::UnregisterForVisualLOD(UEquipmentManagerComponent* Manager)
+{
+	LODManagers.Remove(Manager);
+}
+
+void UEquipmentVisualSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PendingAttachments.Num() == 0 && LODManagers.Num() == 0)
+	{
+		return;
+	}
+
+	FVector ViewLocation = FVector::ZeroVector;
+	FRotator ViewRotation;
+	const APlayerController* LocalPC = FindLocalPlayerController(GetWorld());
+	if (LocalPC)
+	{
+		LocalPC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	}
+
+	TimeUntilLODUpdate -= DeltaTime;
+	if (TimeUntilLODUpdate <= 0.f)
+	{
+		TimeUntilLODUpdate = CVarEquipmentVisualLODUpdateInterval.GetValueOnGameThread();
+		UpdateVisualLODs(ViewLocation, LocalPC != nullptr);
+	}
+
+	if (PendingAttachments.Num() == 0)
+	{
+		return;
+	}
+
+	PendingAttachments.RemoveAll([](const FPendingAttachment& Pending) { return !Pending.Manager.IsValid(); });
+	for (FPendingAttachment& Pending : PendingAttachments)
+	{
+		Pending.Priority = ComputePriority(Pending.Manager.Get(), ViewLocation, LocalPC != nullptr);
+	}
+	PendingAttachments.StableSort([](const FPendingAttachment& A, const FPendingAttachment& B)
+	{
+		return A.Priority < B.Priority;
+	});
+
+	const double BudgetSeconds = CVarEquipmentVisualAttachBudgetMs.GetValueOnGameThread() / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Always make progress — the first attachment runs even if it alone exceeds the budget
+	int32 NumProcessed = 0;
+	while (NumProcessed < PendingAttachments.Num())
+	{
+		// Copy out — attaching may queue more work and reallocate the array
+		const FPendingAttachment Pending = PendingAttachments[NumProcessed++];
+		if (UEquipmentManagerComponent* Manager = Pending.Manager.Get())
+		{
+			Manager->AttachLoadedVisual(Pending.SlotTag);
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+	PendingAttachments.RemoveAt(0, NumProcessed);
+}
+
+void UEquipmentVisualSubsystem::UpdateVisualLODs(const FVector& ViewLocation, bool bHasView)
+{
+	LODManagers.RemoveAll([](const TWeakObjectPtr<UEquipmentManagerComponent>& Manager) { return !Manager.IsValid(); });
+	if (!bHasView)
+	{
+		return;
+	}
+
+	const float ReducedDistance = CVarEquipmentVisualLODReducedDistance.GetValueOnGameThread();
+	const float NoneDistance = CVarEquipmentVisualLODNoneDistance.GetValueOnGameThread();
+	const float Hysteresis = FMath::Max(CVarEquipmentVisualLODHysteresis.GetValueOnGameThread(), 0.f);
+
+	for (const TWeakObjectPtr<UEquipmentManagerComponent>& WeakManager : LODManagers)
+	{
+		UEquipmentManagerComponent* Manager = WeakManager.Get();
+		const AActor* Owner = Manager->GetOwner();
+		if (!Owner)
+		{
+			continue;
+		}
+
+		EEquipmentVisualLOD LOD = EEquipmentVisualLOD::Full;
+		const APawn* Pawn = Cast<APawn>(Owner);
+		if (!Pawn || !Pawn->IsLocallyControlled())
+		{
+			// Each boundary sits Hysteresis past the threshold on the far side of the current tier,
+			// so leaving a tier takes more than touching its edge
+			const EEquipmentVisualLOD CurrentLOD = Manager->GetVisualLOD();
+			const float ReducedBoundary = CurrentLOD == EEquipmentVisualLOD::Full
+				? ReducedDistance + Hysteresis : ReducedDistance - Hysteresis;
+			const float NoneBoundary = CurrentLOD == EEquipmentVisualLOD::None
+				? NoneDistance - Hysteresis : NoneDistance + Hysteresis;
+
+			const float DistanceSq = FVector::DistSquared(ViewLocation, Owner->GetActorLocation());
+			if (DistanceSq > FMath::Square(FMath::Max(NoneBoundary, 0.f)))
+			{
+				LOD = EEquipmentVisualLOD::None;
+			}
+			else if (DistanceSq > FMath::Square(FMath::Max(ReducedBoundary, 0.f)))
+			{
+				LOD = EEquipmentVisualLOD::Reduced;
+			}
+		}
+
+		Manager->SetVisualLOD(LOD);
+	}
+}
+
+TStatId UEquipmentVisualSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEquipmentVisualSubsystem, STATGROUP_Tickables);
+}
+
+float UEquipmentVisualSubsystem::ComputePriority(const UEquipmentManagerComponent* Manager, const FVector& ViewLocation,
+	bool bHasView)
+{
+	const AActor* Owner = Manager->GetOwner();
+	if (!Owner)
+	{
+		return 0.f;
+	}
+
+	// The local player's own equipment always goes first
+	const APawn* Pawn = Cast<APawn>(Owner);
+	if (Pawn && Pawn->IsLocallyControlled())
+	{
+		return -1.f;
+	}
+
+	const float DistanceSq = bHasView ? FVector::DistSquared(ViewLocation, Owner->GetActorLocation()) : 0.f;
+
+	// Off-screen actors rank as if four times farther away (distance squared × 16)
+	return Owner->WasRecentlyRendered(0.2f) ? DistanceSq : DistanceSq * 16.f;
+}
+
+const APlayerController* UEquipmentVisualSubsystem::FindLocalPlayerController(const UWorld* World)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// GetFirstPlayerController on a server can be a remote player's — only a local view counts
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			return PC;
+		}
+	}
+	return nullptr;
+}
@@ -0,0 +1,137 @@
+#include "Misc/AutomationTest.h"
+#include "Types/EquipmentSystemTypes.h"
+#include "Types/CGFItemTypes.h"
+#include "UObject/CoreNet.h"
+#include "UObject/UnrealType.h"
+
+#if WITH_AUTOMATION_TESTS
+
+// ---------------------------------------------------------------------------
+// Helper: a fully configured, occupied slot as the server would hold it
+// ---------------------------------------------------------------------------
+namespace EquipmentNetTestHelpers
+{
+	FEquipmentSlot CreateOccupiedSlot()
+	{
+		FEquipmentSlot Slot;
+		Slot.SlotIndex = 3;
+		Slot.SlotTag = FGameplayTag::RequestGameplayTag(TEXT("Equipment.MainHand"), false);
+		Slot.AttachSocket = TEXT("hand_r_socket");
+		Slot.AcceptedItemTags.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Category.Weapon"), false));
+		Slot.bIsOccupied = true;
+		Slot.EquippedItem.InstanceId = FGuid::NewGuid();
+		Slot.EquippedItem.ItemDefinitionId = FPrimaryAssetId(TEXT("ItemDefinition"), TEXT("Sword"));
+		Slot.EquippedItem.StackCount = 1;
+		return Slot;
+	}
+
+	/**
+	 * Serialize one FEquipmentSlot property the way property replication does without a custom
+	 * NetSerialize: native net serializers where the type has one, binary struct serialization otherwise.
+	 */
+	void SerializeLegacyProperty(FNetBitWriter& Writer, FEquipmentSlot& Slot, FName PropertyName)
+	{
+		FProperty* Prop = FindFProperty<FProperty>(FEquipmentSlot::StaticStruct(), PropertyName);
+		check(Prop);
+		void* Value = Prop->ContainerPtrToValuePtr<void>(&Slot);
+
+		const FStructProperty* StructProp = CastField<FStructProperty>(Prop);
+		if (StructProp && !(StructProp->Struct->StructFlags & STRUCT_NetSerializeNative))
+		{
+			StructProp->Struct->SerializeBin(Writer, Value);
+		}
+		else
+		{
+			Prop->NetSerializeItem(Writer, nullptr, Value);
+		}
+	}
+}
+
+// ===========================================================================
+// Round Trip
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipNet_SlotRoundTrip,
+	"Equipment.Net.SlotNetSerialize.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipNet_SlotRoundTrip::RunTest(const FString& Parameters)
+{
+	FEquipmentSlot Source = EquipmentNetTestHelpers::CreateOccupiedSlot();
+
+	FNetBitWriter Writer(nullptr, 8 * 1024);
+	bool bSuccess = false;
+	Source.NetSerialize(Writer, nullptr, bSuccess);
+	TestTrue("Write succeeded", bSuccess);
+
+	FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+	FEquipmentSlot Received;
+	Received.NetSerialize(Reader, nullptr, bSuccess);
+	TestTrue("Read succeeded", bSuccess);
+
+	TestEqual("Slot index", Received.SlotIndex, Source.SlotIndex);
+	TestTrue("Occupied", Received.bIsOccupied);
+	TestEqual("Instance ID", Received.EquippedItem.InstanceId, Source.EquippedItem.InstanceId);
+	TestEqual("Definition ID", Received.EquippedItem.ItemDefinitionId, Source.EquippedItem.ItemDefinitionId);
+	TestFalse("Static config not sent", Received.AttachSocket == Source.AttachSocket);
+
+	// An empty slot clears the previously received item
+	FEquipmentSlot Empty;
+	Empty.SlotIndex = 3;
+	FNetBitWriter EmptyWriter(nullptr, 8 * 1024);
+	Empty.NetSerialize(EmptyWriter, nullptr, bSuccess);
+	FNetBitReader EmptyReader(nullptr, EmptyWriter.GetData(), EmptyWriter.GetNumBits());
+	Received.NetSerialize(EmptyReader, nullptr, bSuccess);
+	TestFalse("Cleared slot not occupied", Received.bIsOccupied);
+	TestFalse("Cleared slot item invalid", Received.EquippedItem.IsValid());
+
+	return true;
+}
+
+// ===========================================================================
+// Size — compact path vs. the replicated property layout it replaced
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipNet_SlotSize,
+	"Equipment.Net.SlotNetSerialize.Size",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipNet_SlotSize::RunTest(const FString& Parameters)
+{
+	FEquipmentSlot Slot = EquipmentNetTestHelpers::CreateOccupiedSlot();
+	bool bSuccess = false;
+
+	FNetBitWriter CompactWriter(nullptr, 8 * 1024);
+	Slot.NetSerialize(CompactWriter, nullptr, bSuccess);
+
+	// The replicated properties before the custom NetSerialize. Property handles are not counted,
+	// so this is a lower bound on what the old layout put on the wire.
+	const FName LegacyProperties[] = {
+		GET_MEMBER_NAME_CHECKED(FEquipmentSlot, SlotTag),
+		GET_MEMBER_NAME_CHECKED(FEquipmentSlot, EquippedItem),
+		GET_MEMBER_NAME_CHECKED(FEquipmentSlot, bIsOccupied),
+		GET_MEMBER_NAME_CHECKED(FEquipmentSlot, AttachSocket),
+		GET_MEMBER_NAME_CHECKED(FEquipmentSlot, AcceptedItemTags),
+	};
+	FNetBitWriter LegacyWriter(nullptr, 8 * 1024);
+	for (const FName& PropertyName : LegacyProperties)
+	{
+		EquipmentNetTestHelpers::SerializeLegacyProperty(LegacyWriter, Slot, PropertyName);
+	}
+
+	FNetBitWriter ItemWriter(nullptr, 8 * 1024);
+	EquipmentNetTestHelpers::SerializeLegacyProperty(ItemWriter, Slot, GET_MEMBER_NAME_CHECKED(FEquipmentSlot, EquippedItem));
+
+	const int64 CompactBits = CompactWriter.GetNumBits();
+	const int64 LegacyBits = LegacyWriter.GetNumBits();
+	const int64 ItemBits = ItemWriter.GetNumBits();
+	AddInfo(FString::Printf(TEXT("Equip payload: %lld bytes compact vs. %lld bytes with the legacy layout"),
+		(CompactBits + 7) / 8, (LegacyBits + 7) / 8));
+
+	TestTrue("Compact path is smaller", CompactBits < LegacyBits);
+	// Beyond the item, the compact path only sends the slot index and the occupancy bit
+	TestTrue("Compact overhead is the index and occupancy bit", CompactBits <= ItemBits + 32 + 1);
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS
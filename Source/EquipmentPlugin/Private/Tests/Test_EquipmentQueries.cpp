@@ -3,6 +3,10 @@
 #include "Types/CGFItemTypes.h"
 #include "Types/CGFEquipmentTypes.h"
 #include "GameplayTagsManager.h"
+#include "Data/ItemDefinition.h"
+#include "Data/Fragments/ItemFragment_Equipment.h"
+#include "Components/StaticMeshComponent.h"
+#include "Animation/AnimInstance.h"
 
 #if WITH_AUTOMATION_TESTS
 
@@ -25,10 +29,12 @@ namespace EquipmentTestHelpers
 		for (const FName& TagName : SlotTagNames)
 		{
 			FEquipmentSlot Slot;
+			Slot.SlotIndex = static_cast<uint8>(Comp->EquipmentSlots.Slots.Num());
 			Slot.SlotTag = RequestTestTag(TagName);
 			Slot.bIsOccupied = false;
-			Comp->EquipmentSlots.Add(Slot);
+			Comp->EquipmentSlots.Slots.Add(Slot);
 		}
+		Comp->RebuildSlotIndex();
 		return Comp;
 	}
 
@@ -48,14 +54,91 @@ namespace EquipmentTestHelpers
 
 	void PlaceItemInSlot(UEquipmentManagerComponent* Comp, const FItemInstance& Item, int32 SlotIndex)
 	{
-		if (SlotIndex >= 0 && SlotIndex < Comp->EquipmentSlots.Num())
+		if (SlotIndex >= 0 && SlotIndex < Comp->EquipmentSlots.Slots.Num())
 		{
-			Comp->EquipmentSlots[SlotIndex].EquippedItem = Item;
-			Comp->EquipmentSlots[SlotIndex].bIsOccupied = true;
+			Comp->EquipmentSlots.Slots[SlotIndex].EquippedItem = Item;
+			Comp->EquipmentSlots.Slots[SlotIndex].bIsOccupied = true;
+			Comp->RebuildSlotIndex();
 		}
 	}
 }
 
+// ---------------------------------------------------------------------------
+// Private access for tests — declared a friend of UEquipmentManagerComponent
+// ---------------------------------------------------------------------------
+struct FEquipmentManagerTestAccess
+{
+	/** Predict an item change on a slot, as a client request would. Returns the prediction key. */
+	static uint8 PredictSlotChange(UEquipmentManagerComponent* Comp, FGameplayTag SlotTag, const FItemInstance& Item)
+	{
+		const uint8 PredictionKey = Comp->BeginPrediction();
+		Comp->PredictSlotChange(PredictionKey, SlotTag, Item, FEquipmentResolvedItem());
+		return PredictionKey;
+	}
+
+	static void ConfirmPrediction(UEquipmentManagerComponent* Comp, uint8 PredictionKey)
+	{
+		Comp->ClientRPC_ConfirmPrediction_Implementation(PredictionKey);
+	}
+
+	static void RejectPrediction(UEquipmentManagerComponent* Comp, uint8 PredictionKey)
+	{
+		Comp->ClientRPC_EquipmentOperationFailed_Implementation(EEquipmentResult::Failed, PredictionKey);
+	}
+
+	static int32 NumPendingPredictions(const UEquipmentManagerComponent* Comp)
+	{
+		return Comp->PendingPredictions.Num();
+	}
+
+	/** Stand-in for the next-tick flush a world would schedule — changes accumulate until FlushSlotChanges */
+	static void HoldSlotChangeFlush(UEquipmentManagerComponent* Comp)
+	{
+		Comp->bSlotChangeFlushScheduled = true;
+	}
+
+	static void FlushSlotChanges(UEquipmentManagerComponent* Comp)
+	{
+		Comp->FlushSlotChanges();
+	}
+
+	/** Auto-slot target for an item whose equipment fragment prefers PreferredSlotTag */
+	static FGameplayTag FindTargetSlot(const UEquipmentManagerComponent* Comp, FGameplayTag PreferredSlotTag)
+	{
+		UItemFragment_Equipment* EquipFrag = NewObject<UItemFragment_Equipment>();
+		EquipFrag->EquipmentSlotTag = PreferredSlotTag;
+
+		FEquipmentResolvedItem Resolved;
+		Resolved.EquipmentFragment = EquipFrag;
+		return Comp->FindTargetSlot(Resolved);
+	}
+
+	/** Run the client-side replication handler for a slot, as a fast array add/change callback would */
+	static void HandleSlotReplicated(UEquipmentManagerComponent* Comp, int32 SlotIndex)
+	{
+		Comp->HandleSlotReplicated(Comp->EquipmentSlots.Slots[SlotIndex]);
+	}
+
+	static void SetSlotAnimLayer(UEquipmentManagerComponent* Comp, int32 SlotIndex, TSubclassOf<UAnimInstance> LayerClass)
+	{
+		Comp->SetSlotAnimLayer(Comp->EquipmentSlots.Slots[SlotIndex], LayerClass);
+	}
+
+	static int32 NumAnimLayerRefs(const UEquipmentManagerComponent* Comp)
+	{
+		return Comp->AnimLayerRefCounts.Num();
+	}
+
+	static EEquipmentResult ValidateLoadout(const UEquipmentManagerComponent* Comp, const TArray<FEquipmentLoadoutEntry>& Loadout)
+	{
+		TArray<FEquipmentResolvedItem> Resolved;
+		return Comp->ValidateLoadout(Loadout, Resolved);
+	}
+
+	static void BeginChangeBatch(UEquipmentManagerComponent* Comp) { Comp->BeginChangeBatch(); }
+	static void EndChangeBatch(UEquipmentManagerComponent* Comp) { Comp->EndChangeBatch(); }
+};
+
 // ===========================================================================
 // IsSlotOccupied
 // ===========================================================================
@@ -217,6 +300,111 @@ bool FEquipQuery_AllFilled::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ===========================================================================
+// GetSlotIndex
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_GetSlotIndex,
+	"Equipment.Queries.GetSlotIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_GetSlotIndex::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand"), TEXT("Equipment.Head")
+	});
+
+	TestEqual("MainHand at 0", Comp->GetSlotIndex(EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.MainHand"))), 0);
+	TestEqual("Head at 2", Comp->GetSlotIndex(EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.Head"))), 2);
+	TestEqual("Unknown tag", Comp->GetSlotIndex(EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.Nonexistent"))), INDEX_NONE);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+// ===========================================================================
+// Non-Allocating Queries
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_OccupancyMask,
+	"Equipment.Queries.OccupancyMask",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_OccupancyMask::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand"), TEXT("Equipment.Head")
+	});
+
+	TestEqual("Mask sized to slots", Comp->GetOccupancyMask().Num(), 3);
+	TestEqual("Mask empty initially", Comp->GetOccupancyMask().CountSetBits(), 0);
+
+	FItemInstance Helmet = EquipmentTestHelpers::CreateTestItem(TEXT("Helmet"));
+	EquipmentTestHelpers::PlaceItemInSlot(Comp, Helmet, 2);
+
+	TestFalse("Bit 0 clear", Comp->GetOccupancyMask()[0]);
+	TestTrue("Bit 2 set", Comp->GetOccupancyMask()[2]);
+
+	int32 Visited = 0;
+	Comp->ForEachOccupiedSlot([&Visited](const FEquipmentSlot& Slot) { ++Visited; });
+	TestEqual("Visitor sees one occupied slot", Visited, 1);
+
+	const FItemInstance* Found = Comp->FindEquippedItem(EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.Head")));
+	TestNotNull("Pointer to equipped item", Found);
+	if (Found)
+	{
+		TestEqual("Pointer refers to helmet", Found->InstanceId, Helmet.InstanceId);
+	}
+	TestNull("Empty slot yields nullptr",
+		Comp->FindEquippedItem(EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.MainHand"))));
+	TestEqual("Slot view covers all slots", Comp->GetSlots().Num(), 3);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+// ===========================================================================
+// FindTargetSlot
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_FindTargetSlotOrder,
+	"Equipment.Queries.FindTargetSlot.ResolutionOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_FindTargetSlotOrder::RunTest(const FString& Parameters)
+{
+	// The exact-tag slot comes last in slot order, so slot order alone would never pick it first
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand"), TEXT("Equipment")
+	});
+	FGameplayTag Equipment = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment"));
+	FGameplayTag MainHand = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.MainHand"));
+	FGameplayTag OffHand = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.OffHand"));
+
+	TestEqual("Exact tag before child slots",
+		FEquipmentManagerTestAccess::FindTargetSlot(Comp, Equipment), Equipment);
+
+	EquipmentTestHelpers::PlaceItemInSlot(Comp, EquipmentTestHelpers::CreateTestItem(TEXT("Cloak")), 2);
+	TestEqual("Exact slot taken — first free child in slot order",
+		FEquipmentManagerTestAccess::FindTargetSlot(Comp, Equipment), MainHand);
+
+	EquipmentTestHelpers::PlaceItemInSlot(Comp, EquipmentTestHelpers::CreateTestItem(TEXT("Sword")), 0);
+	TestEqual("Free slot before an occupied one",
+		FEquipmentManagerTestAccess::FindTargetSlot(Comp, Equipment), OffHand);
+
+	EquipmentTestHelpers::PlaceItemInSlot(Comp, EquipmentTestHelpers::CreateTestItem(TEXT("Shield")), 1);
+	TestEqual("All taken — first match in slot order as the swap target",
+		FEquipmentManagerTestAccess::FindTargetSlot(Comp, Equipment), MainHand);
+
+	TestEqual("Leaf tag resolves to its own slot",
+		FEquipmentManagerTestAccess::FindTargetSlot(Comp, OffHand), OffHand);
+	TestFalse("Unknown tag resolves to nothing",
+		FEquipmentManagerTestAccess::FindTargetSlot(Comp, EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.Nonexistent"))).IsValid());
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
 // ===========================================================================
 // No Slots
 // ===========================================================================
@@ -238,4 +426,265 @@ bool FEquipQuery_NoSlots::RunTest(const FString& Parameters)
 	return true;
 }
 
+// ===========================================================================
+// Client Prediction
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_PredictionRollback,
+	"Equipment.Prediction.RollbackOnReject",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_PredictionRollback::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand")
+	});
+	FGameplayTag MainHand = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.MainHand"));
+	FGameplayTag OffHand = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.OffHand"));
+
+	FItemInstance Sword = EquipmentTestHelpers::CreateTestItem(TEXT("Sword"));
+	EquipmentTestHelpers::PlaceItemInSlot(Comp, Sword, 0);
+
+	FItemInstance Axe = EquipmentTestHelpers::CreateTestItem(TEXT("Axe"));
+	FItemInstance Shield = EquipmentTestHelpers::CreateTestItem(TEXT("Shield"));
+	const uint8 FirstKey = FEquipmentManagerTestAccess::PredictSlotChange(Comp, MainHand, Axe);
+	FEquipmentManagerTestAccess::PredictSlotChange(Comp, OffHand, Shield);
+
+	TestEqual("Predicted item shown", Comp->GetEquippedItem(MainHand).InstanceId, Axe.InstanceId);
+	TestTrue("Predicted slot occupied", Comp->GetOccupancyMask()[1]);
+	TestEqual("Both predictions pending", FEquipmentManagerTestAccess::NumPendingPredictions(Comp), 2);
+
+	// The later prediction was built on top of the rejected one, so both unwind
+	FEquipmentManagerTestAccess::RejectPrediction(Comp, FirstKey);
+
+	TestEqual("Previous item restored", Comp->GetEquippedItem(MainHand).InstanceId, Sword.InstanceId);
+	TestFalse("Later prediction unwound", Comp->IsSlotOccupied(OffHand));
+	TestFalse("Occupancy bit cleared", Comp->GetOccupancyMask()[1]);
+	TestEqual("No predictions pending", FEquipmentManagerTestAccess::NumPendingPredictions(Comp), 0);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_PredictionConfirmMismatch,
+	"Equipment.Prediction.ConfirmKeyMismatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_PredictionConfirmMismatch::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({TEXT("Equipment.MainHand")});
+	FGameplayTag MainHand = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.MainHand"));
+
+	FItemInstance Sword = EquipmentTestHelpers::CreateTestItem(TEXT("Sword"));
+	const uint8 PredictionKey = FEquipmentManagerTestAccess::PredictSlotChange(Comp, MainHand, Sword);
+	const uint8 OtherKey = PredictionKey == MAX_uint8 ? 1 : PredictionKey + 1;
+
+	// A confirmation for another request leaves this prediction pending...
+	FEquipmentManagerTestAccess::ConfirmPrediction(Comp, OtherKey);
+	TestEqual("Mismatched confirm keeps the prediction", FEquipmentManagerTestAccess::NumPendingPredictions(Comp), 1);
+	TestTrue("Predicted item still shown", Comp->IsSlotOccupied(MainHand));
+
+	// ...so a later rejection can still roll it back
+	FEquipmentManagerTestAccess::RejectPrediction(Comp, PredictionKey);
+	TestFalse("Rejected prediction rolled back", Comp->IsSlotOccupied(MainHand));
+
+	// A matching confirm makes the prediction final — a stale rejection afterwards changes nothing
+	const uint8 ConfirmedKey = FEquipmentManagerTestAccess::PredictSlotChange(Comp, MainHand, Sword);
+	FEquipmentManagerTestAccess::ConfirmPrediction(Comp, ConfirmedKey);
+	TestEqual("Matching confirm clears the prediction", FEquipmentManagerTestAccess::NumPendingPredictions(Comp), 0);
+	FEquipmentManagerTestAccess::RejectPrediction(Comp, ConfirmedKey);
+	TestEqual("Confirmed item kept", Comp->GetEquippedItem(MainHand).InstanceId, Sword.InstanceId);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+// ===========================================================================
+// Loadout Validation
+// ===========================================================================
+
+namespace EquipmentTestHelpers
+{
+	FEquipmentLoadoutEntry MakeLoadoutEntry(const FName& SlotTagName, const FItemInstance& Item)
+	{
+		FEquipmentLoadoutEntry Entry;
+		Entry.SlotTag = RequestTestTag(SlotTagName);
+		Entry.Item = Item;
+		return Entry;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_LoadoutDuplicateItem,
+	"Equipment.Loadout.Validate.DuplicateItem",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_LoadoutDuplicateItem::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand")
+	});
+
+	// The same instance listed for two slots is rejected before any item is resolved
+	const FItemInstance Dagger = EquipmentTestHelpers::CreateTestItem(TEXT("Dagger"));
+	const TArray<FEquipmentLoadoutEntry> Loadout = {
+		EquipmentTestHelpers::MakeLoadoutEntry(TEXT("Equipment.MainHand"), Dagger),
+		EquipmentTestHelpers::MakeLoadoutEntry(TEXT("Equipment.OffHand"), Dagger),
+	};
+	TestTrue("Repeated item rejected",
+		FEquipmentManagerTestAccess::ValidateLoadout(Comp, Loadout) == EEquipmentResult::Failed);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_LoadoutItemEquippedElsewhere,
+	"Equipment.Loadout.Validate.ItemEquippedElsewhere",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_LoadoutItemEquippedElsewhere::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand")
+	});
+
+	const FItemInstance Dagger = EquipmentTestHelpers::CreateTestItem(TEXT("Dagger"));
+	EquipmentTestHelpers::PlaceItemInSlot(Comp, Dagger, 1);
+
+	// Off hand is not part of the loadout, so the dagger would end up in both hands
+	const TArray<FEquipmentLoadoutEntry> Loadout = {
+		EquipmentTestHelpers::MakeLoadoutEntry(TEXT("Equipment.MainHand"), Dagger),
+	};
+	TestTrue("Item equipped in an unlisted slot rejected",
+		FEquipmentManagerTestAccess::ValidateLoadout(Comp, Loadout) == EEquipmentResult::SlotOccupied);
+
+	// Once the loadout clears the off hand the move passes this check (resolving then fails without assets)
+	const TArray<FEquipmentLoadoutEntry> MoveLoadout = {
+		EquipmentTestHelpers::MakeLoadoutEntry(TEXT("Equipment.MainHand"), Dagger),
+		EquipmentTestHelpers::MakeLoadoutEntry(TEXT("Equipment.OffHand"), FItemInstance()),
+	};
+	TestTrue("Item moved out of a cleared slot not rejected as occupied",
+		FEquipmentManagerTestAccess::ValidateLoadout(Comp, MoveLoadout) != EEquipmentResult::SlotOccupied);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+// ===========================================================================
+// Replicated Visuals
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_ReplicatedSwapToMeshless,
+	"Equipment.Replication.SwapToMeshlessItem",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_ReplicatedSwapToMeshless::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({TEXT("Equipment.MainHand")});
+
+	// The slot shows a sword: resolved definition, attached component and a linked anim layer
+	EquipmentTestHelpers::PlaceItemInSlot(Comp, EquipmentTestHelpers::CreateTestItem(TEXT("Sword")), 0);
+	FEquipmentSlot& Slot = Comp->EquipmentSlots.Slots[0];
+	Slot.ResolvedItem.Definition = NewObject<UItemDefinition>();
+	Slot.ResolvedItem.EquipmentFragment = NewObject<UItemFragment_Equipment>();
+	Slot.AttachedVisualComponent = NewObject<UStaticMeshComponent>();
+	FEquipmentManagerTestAccess::SetSlotAnimLayer(Comp, 0, UAnimInstance::StaticClass());
+
+	// Replicated swap to an item without a mesh — it resolves to a different (here: no) definition
+	Slot.EquippedItem = EquipmentTestHelpers::CreateTestItem(TEXT("Rune"));
+	FEquipmentManagerTestAccess::HandleSlotReplicated(Comp, 0);
+
+	TestNull("Outgoing component released", Slot.AttachedVisualComponent.Get());
+	TestFalse("No load handle kept", Slot.MeshLoadHandle.IsValid());
+	TestNull("Outgoing anim layer released", Slot.LinkedAnimLayerClass.Get());
+	TestEqual("No anim layer references left", FEquipmentManagerTestAccess::NumAnimLayerRefs(Comp), 0);
+	TestTrue("Slot still occupied by the new item", Comp->GetOccupancyMask()[0]);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+// ===========================================================================
+// Change Notifications
+// ===========================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_SlotsChangedMask,
+	"Equipment.ChangeNotifications.SlotMask",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_SlotsChangedMask::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand"), TEXT("Equipment.Head")
+	});
+	FGameplayTag MainHand = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.MainHand"));
+	FGameplayTag Head = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.Head"));
+
+	TArray<TBitArray<>> Broadcasts;
+	Comp->OnEquipmentSlotsChanged.AddLambda([&Broadcasts](const TBitArray<>& ChangedSlots)
+	{
+		Broadcasts.Add(ChangedSlots);
+	});
+
+	// No world — each change broadcasts at once, naming only its own slot
+	FEquipmentManagerTestAccess::PredictSlotChange(Comp, MainHand, EquipmentTestHelpers::CreateTestItem(TEXT("Sword")));
+	FEquipmentManagerTestAccess::PredictSlotChange(Comp, Head, EquipmentTestHelpers::CreateTestItem(TEXT("Helmet")));
+
+	if (TestEqual("One broadcast per change", Broadcasts.Num(), 2))
+	{
+		TestEqual("Mask covers every slot", Broadcasts[0].Num(), 3);
+		TestTrue("First change names main hand", Broadcasts[0][0]);
+		TestEqual("First change names only main hand", Broadcasts[0].CountSetBits(), 1);
+		TestTrue("Second change names head", Broadcasts[1][2]);
+		TestEqual("Second change names only head", Broadcasts[1].CountSetBits(), 1);
+	}
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEquipQuery_SlotsChangedBatched,
+	"Equipment.ChangeNotifications.BatchedMask",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEquipQuery_SlotsChangedBatched::RunTest(const FString& Parameters)
+{
+	auto* Comp = EquipmentTestHelpers::CreateTestEquipment({
+		TEXT("Equipment.MainHand"), TEXT("Equipment.OffHand"), TEXT("Equipment.Head")
+	});
+	FGameplayTag MainHand = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.MainHand"));
+	FGameplayTag Head = EquipmentTestHelpers::RequestTestTag(TEXT("Equipment.Head"));
+
+	TArray<TBitArray<>> Broadcasts;
+	Comp->OnEquipmentSlotsChanged.AddLambda([&Broadcasts](const TBitArray<>& ChangedSlots)
+	{
+		Broadcasts.Add(ChangedSlots);
+	});
+
+	// Several changes in one frame, one slot changed twice, inside a change batch
+	FEquipmentManagerTestAccess::HoldSlotChangeFlush(Comp);
+	FEquipmentManagerTestAccess::BeginChangeBatch(Comp);
+	FEquipmentManagerTestAccess::PredictSlotChange(Comp, MainHand, EquipmentTestHelpers::CreateTestItem(TEXT("Sword")));
+	FEquipmentManagerTestAccess::PredictSlotChange(Comp, Head, EquipmentTestHelpers::CreateTestItem(TEXT("Helmet")));
+	FEquipmentManagerTestAccess::PredictSlotChange(Comp, MainHand, EquipmentTestHelpers::CreateTestItem(TEXT("Axe")));
+	FEquipmentManagerTestAccess::EndChangeBatch(Comp);
+
+	TestEqual("Nothing broadcast before the flush", Broadcasts.Num(), 0);
+
+	FEquipmentManagerTestAccess::FlushSlotChanges(Comp);
+
+	if (TestEqual("One broadcast for the whole frame", Broadcasts.Num(), 1))
+	{
+		TestTrue("Main hand bit set", Broadcasts[0][0]);
+		TestFalse("Untouched off hand bit clear", Broadcasts[0][1]);
+		TestTrue("Head bit set", Broadcasts[0][2]);
+	}
+
+	// The flush consumed the pending mask — an empty flush broadcasts nothing
+	FEquipmentManagerTestAccess::FlushSlotChanges(Comp);
+	TestEqual("Empty flush is silent", Broadcasts.Num(), 1);
+
+	EquipmentTestHelpers::CleanupEquipment(Comp);
+	return true;
+}
+
 #endif // WITH_AUTOMATION_TESTS
@@ -27,10 +27,7 @@ void UEquipmentSlotWidget::NativeOnInitialized()
 
 void UEquipmentSlotWidget::NativeDestruct()
 {
-	if (BoundEquipmentManager)
-	{
-		BoundEquipmentManager->OnEquipmentChanged.RemoveDynamic(this, &UEquipmentSlotWidget::HandleEquipmentChanged);
-	}
+	UnbindEquipmentManager();
 
 	if (IconLoadHandle.IsValid())
 	{
@@ -109,10 +106,7 @@ void UEquipmentSlotWidget::BuildWidgetTree()
 void UEquipmentSlotWidget::InitSlot(UEquipmentManagerComponent* InEquipmentManager, FGameplayTag InSlotTag)
 {
 	// Unbind old
-	if (BoundEquipmentManager)
-	{
-		BoundEquipmentManager->OnEquipmentChanged.RemoveDynamic(this, &UEquipmentSlotWidget::HandleEquipmentChanged);
-	}
+	UnbindEquipmentManager();
 
 	BoundEquipmentManager = InEquipmentManager;
 	SlotTag = InSlotTag;
@@ -120,7 +114,8 @@ void UEquipmentSlotWidget::InitSlot(UEquipmentManagerComponent* InEquipmentManag
 	// Bind new
 	if (BoundEquipmentManager)
 	{
-		BoundEquipmentManager->OnEquipmentChanged.AddDynamic(this, &UEquipmentSlotWidget::HandleEquipmentChanged);
+		SlotsChangedHandle = BoundEquipmentManager->OnEquipmentSlotsChanged.AddUObject(
+			this, &UEquipmentSlotWidget::HandleEquipmentSlotsChanged);
 	}
 
 	// Set slot display name from definition
@@ -243,7 +238,20 @@ void UEquipmentSlotWidget::SetHeld(bool bInHeld)
 	}
 }
 
-void UEquipmentSlotWidget::HandleEquipmentChanged()
+void UEquipmentSlotWidget::HandleEquipmentSlotsChanged(const TBitArray<>& ChangedSlots)
 {
-	RefreshSlot();
+	const int32 SlotIndex = BoundEquipmentManager ? BoundEquipmentManager->GetSlotIndex(SlotTag) : INDEX_NONE;
+	if (SlotIndex != INDEX_NONE && ChangedSlots.IsValidIndex(SlotIndex) && ChangedSlots[SlotIndex])
+	{
+		RefreshSlot();
+	}
+}
+
+void UEquipmentSlotWidget::UnbindEquipmentManager()
+{
+	if (BoundEquipmentManager && SlotsChangedHandle.IsValid())
+	{
+		BoundEquipmentManager->OnEquipmentSlotsChanged.Remove(SlotsChangedHandle);
+	}
+	SlotsChangedHandle.Reset();
 }
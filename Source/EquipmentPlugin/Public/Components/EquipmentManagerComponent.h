@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
 #include "GameplayTagContainer.h"
 #include "Types/CGFCommonEnums.h"
 #include "Types/CGFEquipmentTypes.h"
@@ -10,11 +11,19 @@
 #include "EquipmentManagerComponent.generated.h"
 
 class UInventoryComponent;
+class APawn;
+class AController;
 class UItemDatabaseSubsystem;
 class UItemFragment_Equipment;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEquipmentOperationFailed, EEquipmentResult, Result);
 
+/** Coalesced once-per-frame change event — one bit per EquipmentSlots entry, set for each slot that changed */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEquipmentSlotsChanged, const TBitArray<>& /*ChangedSlots*/);
+
+/** Blueprint form of FOnEquipmentSlotsChanged — the changed slots as tags */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEquipmentSlotTagsChanged, const TArray<FGameplayTag>&, ChangedSlotTags);
+
 /**
  * Manages equipment slots on a character. Handles equip/unequip flow,
  * visual attachment, inventory integration, and multiplayer replication.
@@ -32,17 +41,88 @@ public:
 	// Configuration
 	// -----------------------------------------------------------------------
 
-	/** Slot definitions — configure in editor to define available equipment slots */
+	/** Slot definitions — configure in editor to define available equipment slots (fewer than 255; larger layouts are rejected) */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config")
 	TArray<FEquipmentSlotDefinition> AvailableSlots;
 
+	/**
+	 * Apply equip/unequip requests locally on the owning client before the server answers.
+	 * Each request carries a prediction key; the server confirms or rejects it and rejected changes are rolled back.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config")
+	bool bPredictClientChanges = true;
+
+	/**
+	 * Unequipped visual components kept registered (hidden) per mesh type for reuse by the next equip.
+	 * 0 disables pooling — components are destroyed on unequip.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config", meta = (ClampMin = "0"))
+	int32 MaxPooledVisualComponents = 4;
+
+	/**
+	 * Per-slot visual options (e.g. drive armor from the owner mesh via leader pose).
+	 * Slots without an entry evaluate their own animation.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config")
+	TArray<FEquipmentSlotVisualSettings> SlotVisualSettings;
+
+	/**
+	 * Merge the owner's body mesh and all skeletal equipment into one skeletal mesh on the owner mesh
+	 * component instead of attaching a component per piece (intended for NPC crowds).
+	 * Rebuilt once pending mesh loads finish after a loadout change; identical loadouts share the
+	 * merged asset through UEquipmentMeshMergeSubsystem. Static mesh equipment is still attached.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config")
+	bool bMergeSkeletalEquipment = false;
+
+	/**
+	 * Distance to the local viewer at which replicated visual loads drop to default priority.
+	 * Closer characters load their equipment at up to high priority.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config", meta = (ClampMin = "1.0", Units = "cm"))
+	float VisualLoadPriorityDistance = 5000.f;
+
+	/**
+	 * Load and attach equipment meshes on dedicated servers too. Off by default — headless servers skip
+	 * the whole visual pipeline. Enable only when server code needs equipment sockets (e.g. hit detection).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config")
+	bool bApplyVisualsOnDedicatedServer = false;
+
+	/**
+	 * Let UEquipmentVisualSubsystem pick the visual LOD tier from distance to the local view.
+	 * Disable to drive SetVisualLOD yourself (e.g. from the Significance Manager).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Equipment|Config")
+	bool bAutomaticVisualLOD = true;
+
+	/** Skeletal mesh equipment attaches to. Empty = first USkeletalMeshComponent on the owner. */
+	UPROPERTY(EditAnywhere, Category = "Equipment|Config", meta = (UseComponentPicker, AllowedClasses = "/Script/Engine.SkeletalMeshComponent"))
+	FComponentReference OwnerMeshReference;
+
+	/** Ability system component GAS integration uses. Empty = first matching component on the owner. */
+	UPROPERTY(EditAnywhere, Category = "Equipment|Config", meta = (UseComponentPicker))
+	FComponentReference AbilitySystemReference;
+
+	/**
+	 * Optional infinite gameplay effect whose SetByCaller modifiers (one per attribute/op) carry
+	 * the summed passive stats of every equipped item. Passive effects made only of constant
+	 * modifiers it has a channel for are folded into it instead of being applied per item.
+	 * Empty = every passive effect is applied on its own. Requires EquipmentGASIntegration.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Equipment|Config", meta = (MetaClass = "/Script/GameplayAbilities.GameplayEffect"))
+	FSoftClassPath AggregatedStatsEffect;
+
 	// -----------------------------------------------------------------------
 	// State
 	// -----------------------------------------------------------------------
 
-	/** Runtime equipment slots (replicated) */
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_EquipmentSlots, Category = "Equipment|State")
-	TArray<FEquipmentSlot> EquipmentSlots;
+	/**
+	 * Runtime equipment slots (delta-replicated per slot, owner only).
+	 * Simulated proxies rebuild these locally from VisualSlots and only see item definition IDs.
+	 */
+	UPROPERTY(BlueprintReadOnly, Replicated, Category = "Equipment|State")
+	FEquipmentSlotContainer EquipmentSlots;
 
 	// -----------------------------------------------------------------------
 	// Direct Equip/Unequip (no inventory)
@@ -60,6 +140,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	EEquipmentResult TryUnequip(FGameplayTag SlotTag, FItemInstance& OutItem);
 
+	// -----------------------------------------------------------------------
+	// Batch Equip
+	// -----------------------------------------------------------------------
+
+	/**
+	 * Apply a whole loadout in one transaction. Every entry is validated up front, so either
+	 * every entry is applied or none; clients send a single RPC. GAS is updated in one pass
+	 * and OnEquipmentChanged fires once.
+	 * OutDisplacedItems receives the items the loadout removed from their slots (items it only
+	 * moves to another slot are not included) — the caller decides where they go.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	EEquipmentResult TryApplyLoadout(const TArray<FEquipmentLoadoutEntry>& Loadout, TArray<FItemInstance>& OutDisplacedItems);
+
 	// -----------------------------------------------------------------------
 	// Inventory-Integrated Equip/Unequip
 	// -----------------------------------------------------------------------
@@ -89,6 +183,68 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Equipment|Query")
 	TArray<FGameplayTag> GetEmptySlotTags() const;
 
+	/** Index of a slot in EquipmentSlots, or INDEX_NONE. Constant time. */
+	int32 GetSlotIndex(FGameplayTag SlotTag) const;
+
+	// -----------------------------------------------------------------------
+	// Non-Allocating Queries (C++ only — the Blueprint queries above wrap these)
+	// -----------------------------------------------------------------------
+
+	/** One bit per entry in EquipmentSlots (same index as GetSlotIndex), set when occupied */
+	const TBitArray<>& GetOccupancyMask() const { return OccupancyMask; }
+
+	/** All runtime slots, without copying */
+	TConstArrayView<FEquipmentSlot> GetSlots() const { return EquipmentSlots.Slots; }
+
+	/** Equipped item in a slot, or nullptr if the slot is empty or unknown */
+	const FItemInstance* FindEquippedItem(FGameplayTag SlotTag) const;
+
+	/** Invoke Func(const FEquipmentSlot&) for every occupied slot, in slot order */
+	template<typename FuncType>
+	void ForEachOccupiedSlot(FuncType&& Func) const
+	{
+		for (TConstSetBitIterator<> It(OccupancyMask); It; ++It)
+		{
+			Func(EquipmentSlots.Slots[It.GetIndex()]);
+		}
+	}
+
+	/** False on dedicated servers unless bApplyVisualsOnDedicatedServer — no mesh loads or attachments happen */
+	bool AreVisualsEnabled() const;
+
+	// -----------------------------------------------------------------------
+	// Owner Bindings (cached once found)
+	// -----------------------------------------------------------------------
+
+	/** Owner's skeletal mesh for socket attachment (OwnerMeshReference, else the first one found) */
+	USkeletalMeshComponent* GetOwnerMesh() const;
+
+	/** Owner's ability system component of the given class (AbilitySystemReference, else the first one found) */
+	UActorComponent* GetAbilitySystemBinding(TSubclassOf<UActorComponent> ComponentClass) const;
+
+	/**
+	 * Drop the cached owner mesh, ASC and inventory. Destroyed components are re-resolved automatically, and a
+	 * pawn owner's controller change or the reference setters below invalidate on their own; call this after
+	 * adding components to the owner at runtime.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	void InvalidateOwnerBindings();
+
+	/** Change OwnerMeshReference at runtime and re-resolve the owner mesh */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	void SetOwnerMeshReference(const FComponentReference& NewReference);
+
+	/** Change AbilitySystemReference at runtime and re-resolve the ability system binding */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	void SetAbilitySystemReference(const FComponentReference& NewReference);
+
+	/** Change the visual detail tier — adds/removes slot components and anim layers to match */
+	UFUNCTION(BlueprintCallable, Category = "Equipment|Visuals")
+	void SetVisualLOD(EEquipmentVisualLOD NewLOD);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Equipment|Visuals")
+	EEquipmentVisualLOD GetVisualLOD() const { return VisualLOD; }
+
 	/** Check if an item can be equipped (validation only, no side effects) */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Equipment|Query")
 	bool CanEquipItem(const FItemInstance& Item) const;
@@ -100,16 +256,24 @@ public:
 	/** Static factory delegate — set by EquipmentGASIntegration module's StartupModule() */
 	static TFunction<void(UEquipmentManagerComponent*)> GASSetupFactory;
 
-	/** GAS handler objects — stored to prevent GC, created by GASSetupFactory */
-	UPROPERTY()
-	TObjectPtr<UObject> GASAbilityGranter;
+	/**
+	 * GAS operation callbacks — bound by the GAS module, called by Internal_Equip/Unequip.
+	 * The equip callback receives the equipment fragment already resolved for the slot.
+	 */
+	TFunction<void(const FItemInstance&, FGameplayTag, const UItemFragment_Equipment*)> OnGASEquipCallback;
+	TFunction<void(FGameplayTag)> OnGASUnequipCallback;
 
-	UPROPERTY()
-	TObjectPtr<UObject> GASEffectApplier;
+	/**
+	 * Called instead of unequip + equip when a batch replaces a slot's item, so handlers can
+	 * diff the old and new grants. Unbound = falls back to the unequip and equip callbacks.
+	 */
+	TFunction<void(const FItemInstance&, FGameplayTag, const UItemFragment_Equipment*)> OnGASSwapCallback;
 
-	/** GAS operation callbacks — bound by the GAS module, called by Internal_Equip/Unequip */
-	TFunction<void(const FItemInstance&, FGameplayTag)> OnGASEquipCallback;
-	TFunction<void(FGameplayTag)> OnGASUnequipCallback;
+	/** Called once after a run of equip/unequip callbacks has been delivered (a single change or a whole batch) */
+	TFunction<void()> OnGASCommitCallback;
+
+	/** Called from EndPlay so the GAS module can free whatever it keeps for this component */
+	TFunction<void()> OnGASReleaseCallback;
 
 	// -----------------------------------------------------------------------
 	// Extension Points
@@ -139,54 +303,200 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Equipment|Events")
 	FOnEquipmentOperationFailed OnOperationFailed;
 
+	/**
+	 * Fires at most once per frame with the slots changed since the last broadcast (same indices as GetSlotIndex).
+	 * Prefer this over OnEquipmentChanged for per-slot UI — a swap is one event, and unaffected slots can skip work.
+	 */
+	FOnEquipmentSlotsChanged OnEquipmentSlotsChanged;
+
+	/** Same broadcast as OnEquipmentSlotsChanged, for Blueprint — the tags of the changed slots */
+	UPROPERTY(BlueprintAssignable, Category = "Equipment|Events")
+	FOnEquipmentSlotTagsChanged OnEquipmentSlotTagsChanged;
+
+	// -----------------------------------------------------------------------
+	// Slot Index
+	// -----------------------------------------------------------------------
+
+	/**
+	 * Rebuild the tag-to-index lookup tables and occupancy mask from EquipmentSlots and AvailableSlots.
+	 * Called automatically on BeginPlay and after replication updates that change the slot layout; call manually only
+	 * after editing EquipmentSlots directly.
+	 */
+	void RebuildSlotIndex();
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 private:
+	friend struct FEquipmentSlot;
+	friend struct FEquipmentSlotContainer;
+	friend struct FEquipmentVisualSlot;
+	friend struct FEquipmentVisualSlotContainer;
+	friend class UEquipmentVisualSubsystem;
+	friend struct FEquipmentManagerTestAccess;
+
+	/** Compact visual state for everyone but the owner (definition ID per slot) */
+	UPROPERTY(Replicated)
+	FEquipmentVisualSlotContainer VisualSlots;
+
 	// -----------------------------------------------------------------------
-	// Replication
+	// Replication (fast array callbacks, clients only)
 	// -----------------------------------------------------------------------
 
-	UFUNCTION()
-	void OnRep_EquipmentSlots();
+	/** A slot was added or changed by replication — sync its visuals */
+	void HandleSlotReplicated(FEquipmentSlot& Slot);
+
+	/** A slot is about to be removed by replication — drop its visuals */
+	void HandleSlotRemoved(FEquipmentSlot& Slot);
+
+	/** A replication update finished applying — notify listeners once */
+	void HandleSlotsReplicated();
+
+	/** A visual record arrived on a simulated proxy — mirror it into the local slot */
+	void HandleVisualSlotReplicated(const FEquipmentVisualSlot& Record);
+
+	/** Build local runtime slots from AvailableSlots on proxies, which never receive EquipmentSlots */
+	void EnsureProxySlots();
+
+	/** Fill a slot's static config (tag, socket, accepted tags) from AvailableSlots[SlotIndex] */
+	void ApplySlotDefinition(FEquipmentSlot& Slot, int32 DefinitionIndex) const;
 
 	// -----------------------------------------------------------------------
 	// Server RPCs
 	// -----------------------------------------------------------------------
 
+	// Every request carries the client's prediction key (NoPredictionKey when nothing was predicted)
+
 	UFUNCTION(Server, Reliable)
-	void ServerRPC_RequestEquip(const FItemInstance& Item, FGameplayTag SlotTag);
+	void ServerRPC_RequestEquip(const FItemInstance& Item, FGameplayTag SlotTag, uint8 PredictionKey);
 
 	UFUNCTION(Server, Reliable)
-	void ServerRPC_RequestUnequip(FGameplayTag SlotTag);
+	void ServerRPC_RequestUnequip(FGameplayTag SlotTag, uint8 PredictionKey);
 
 	UFUNCTION(Server, Reliable)
 	void ServerRPC_RequestEquipFromInventory(const FGuid& ItemInstanceId,
-		UInventoryComponent* SourceInventory, FGameplayTag SlotTag);
+		UInventoryComponent* SourceInventory, FGameplayTag SlotTag, uint8 PredictionKey);
 
 	UFUNCTION(Server, Reliable)
-	void ServerRPC_RequestUnequipToInventory(FGameplayTag SlotTag, UInventoryComponent* TargetInventory);
+	void ServerRPC_RequestUnequipToInventory(FGameplayTag SlotTag, UInventoryComponent* TargetInventory,
+		uint8 PredictionKey);
+
+	UFUNCTION(Server, Reliable)
+	void ServerRPC_RequestApplyLoadout(const TArray<FEquipmentLoadoutEntry>& Loadout, uint8 PredictionKey);
+
+	/**
+	 * Compact variants — carry only the item GUID and a slot index (NoSlotIndex = auto-detect).
+	 * The server resolves the item from the owner's inventory instead of trusting client data.
+	 */
+	UFUNCTION(Server, Reliable)
+	void ServerRPC_RequestEquipById(const FGuid& ItemInstanceId, uint8 SlotIndex, uint8 PredictionKey);
+
+	UFUNCTION(Server, Reliable)
+	void ServerRPC_RequestEquipFromOwnerInventory(const FGuid& ItemInstanceId, uint8 SlotIndex,
+		uint8 PredictionKey);
+
+	/** Slot index sent when the server should pick the slot */
+	static constexpr uint8 NoSlotIndex = MAX_uint8;
 
 	// -----------------------------------------------------------------------
 	// Client RPC
 	// -----------------------------------------------------------------------
 
+	/** Request rejected — rolls back the prediction (if any) and broadcasts OnOperationFailed */
 	UFUNCTION(Client, Reliable)
-	void ClientRPC_EquipmentOperationFailed(EEquipmentResult Result);
+	void ClientRPC_EquipmentOperationFailed(EEquipmentResult Result, uint8 PredictionKey);
+
+	/** Request applied on the server — the predicted changes become the baseline */
+	UFUNCTION(Client, Reliable)
+	void ClientRPC_ConfirmPrediction(uint8 PredictionKey);
+
+	/** Answer a client request: confirm its prediction on success, report failure otherwise */
+	void RespondToRequest(uint8 PredictionKey, EEquipmentResult Result);
+
+	// -----------------------------------------------------------------------
+	// Client Prediction
+	// -----------------------------------------------------------------------
+
+	/** Key sent with requests the client did not predict */
+	static constexpr uint8 NoPredictionKey = 0;
+
+	/** Allocate a key for a new request (NoPredictionKey when prediction is disabled) */
+	uint8 BeginPrediction();
+
+	/** Apply a slot change locally under a prediction key, remembering the previous state for rollback. Invalid Item clears the slot. */
+	void PredictSlotChange(uint8 PredictionKey, FGameplayTag SlotTag, const FItemInstance& Item,
+		const FEquipmentResolvedItem& Resolved);
+
+	/** Restore every slot changed by this prediction and by any prediction made after it */
+	void RollbackPrediction(uint8 PredictionKey);
+
+	/** Set a slot's contents and visuals on the client without touching GAS or replication */
+	void SetSlotLocal(FEquipmentSlot& Slot, const FItemInstance& Item, const FEquipmentResolvedItem& Resolved);
+
+	/** Slot state captured before a predicted change */
+	struct FPredictedSlotChange
+	{
+		uint8 PredictionKey = NoPredictionKey;
+		int32 SlotArrayIndex = INDEX_NONE;
+		FItemInstance PreviousItem;
+		FEquipmentResolvedItem PreviousResolved;
+	};
+
+	/** Unanswered predictions, oldest first */
+	TArray<FPredictedSlotChange> PendingPredictions;
+
+	/** Last key handed out — rolls over, skipping NoPredictionKey */
+	uint8 LastPredictionKey = NoPredictionKey;
 
 	// -----------------------------------------------------------------------
 	// Internal
 	// -----------------------------------------------------------------------
 
+	/** Equip with an already-resolved item (shared by TryEquip/TryEquipToSlot) */
+	EEquipmentResult TryEquipResolved(const FItemInstance& Item, const FEquipmentResolvedItem& Resolved,
+		FGameplayTag SlotTag);
+
 	/** Find the target slot for an item based on its EquipmentSlotTag */
 	FGameplayTag FindTargetSlot(const FItemInstance& Item) const;
+	FGameplayTag FindTargetSlot(const FEquipmentResolvedItem& Resolved) const;
 
 	/** Validate that an item can go into a specific slot */
 	EEquipmentResult ValidateEquip(const FItemInstance& Item, FGameplayTag SlotTag) const;
+	EEquipmentResult ValidateEquip(const FItemInstance& Item, const FEquipmentResolvedItem& Resolved,
+		FGameplayTag SlotTag) const;
+
+	/**
+	 * Validate every loadout entry (slot exists, no duplicate slots or items, item fits). An item already equipped
+	 * in a slot the loadout does not list is rejected with SlotOccupied. Outputs one resolved item per entry.
+	 */
+	EEquipmentResult ValidateLoadout(const TArray<FEquipmentLoadoutEntry>& Loadout,
+		TArray<FEquipmentResolvedItem>& OutResolved) const;
+
+	/** Server side of a direct equip (item already resolved), shared by the full-item and GUID-only RPCs */
+	EEquipmentResult Server_Equip(const FItemInstance& Item, const FEquipmentResolvedItem& Resolved,
+		FGameplayTag SlotTag);
 
-	/** Core equip logic (after validation) */
-	void Internal_Equip(const FItemInstance& Item, FGameplayTag SlotTag);
+	/** Server side of equip-from-inventory, shared by the tag and GUID-only RPCs */
+	EEquipmentResult Server_EquipFromInventory(const FGuid& ItemInstanceId, UInventoryComponent* SourceInventory,
+		FGameplayTag SlotTag);
+
+	/** Slot index to put on the wire for a slot tag (NoSlotIndex if invalid or unknown) */
+	uint8 GetNetSlotIndex(FGameplayTag SlotTag) const;
+
+	/** Slot tag for a slot index received over the wire (invalid tag for NoSlotIndex) */
+	FGameplayTag GetSlotTagFromNetIndex(uint8 SlotIndex) const;
+
+	/** Core batch logic (after validation — every entry's slot exists, so every entry applies) */
+	void Internal_ApplyLoadout(const TArray<FEquipmentLoadoutEntry>& Loadout,
+		const TArray<FEquipmentResolvedItem>& Resolved, TArray<FItemInstance>& OutDisplacedItems);
+
+	/** Drop items the loadout re-equips elsewhere from DisplacedItems (matched by instance id) */
+	static void RemoveReequippedItems(const TArray<FEquipmentLoadoutEntry>& Loadout, TArray<FItemInstance>& DisplacedItems);
+
+	/** Core equip logic (after validation). Returns false if the slot does not exist. */
+	bool Internal_Equip(const FItemInstance& Item, FGameplayTag SlotTag, const FEquipmentResolvedItem& Resolved);
 
 	/** Core unequip logic */
 	FItemInstance Internal_Unequip(FGameplayTag SlotTag);
@@ -198,12 +508,46 @@ private:
 	/** Find slot definition by tag */
 	const FEquipmentSlotDefinition* FindSlotDefinition(FGameplayTag SlotTag) const;
 
+	// -----------------------------------------------------------------------
+	// Change Batching
+	// -----------------------------------------------------------------------
+
+	/** Open a change batch — GAS updates and OnEquipmentChanged are deferred until the outermost EndChangeBatch */
+	void BeginChangeBatch();
+
+	/** Close a change batch — flushes deferred GAS updates and broadcasts OnEquipmentChanged once */
+	void EndChangeBatch();
+
+	/** Broadcast OnEquipmentChanged now (or once at the end of the current batch) and queue the slot for OnEquipmentSlotsChanged */
+	void NotifyEquipmentChanged(FGameplayTag SlotTag);
+
+	/** Set a slot's bit in the pending change mask and schedule the coalesced broadcast */
+	void MarkSlotChanged(int32 SlotArrayIndex);
+
+	/** Broadcast OnEquipmentSlotsChanged and OnEquipmentSlotTagsChanged with everything queued since the last flush */
+	void FlushSlotChanges();
+
+	/** Flush deferred GAS updates: all revokes first, then all grants */
+	void FlushPendingGAS();
+
+	/** Deferred GAS work for one slot, coalesced across a batch */
+	struct FPendingGASChange
+	{
+		FGameplayTag SlotTag;
+		FItemInstance GrantItem;
+		UItemFragment_Equipment* GrantFragment = nullptr;
+		bool bRevoke = false;
+		bool bGrant = false;
+	};
+
+	FPendingGASChange& FindOrAddPendingGAS(FGameplayTag SlotTag);
+
 	// -----------------------------------------------------------------------
 	// GAS Helpers
 	// -----------------------------------------------------------------------
 
 	/** Apply GAS abilities/effects for an equipped item (server-only, no-op if GAS not available) */
-	void ApplyGAS(const FItemInstance& Item, FGameplayTag SlotTag);
+	void ApplyGAS(const FItemInstance& Item, FGameplayTag SlotTag, UItemFragment_Equipment* EquipFrag);
 
 	/** Remove GAS abilities/effects for a slot (server-only, no-op if GAS not available) */
 	void RemoveGAS(FGameplayTag SlotTag);
@@ -212,20 +556,164 @@ private:
 	// Visuals
 	// -----------------------------------------------------------------------
 
-	void ApplyVisuals(const FItemInstance& Item, FGameplayTag SlotTag);
+	void ApplyVisuals(FGameplayTag SlotTag);
 	void RemoveVisuals(FGameplayTag SlotTag);
+	/** Mesh load finished — queue the attachment with UEquipmentVisualSubsystem (time-sliced across managers) */
 	void OnMeshLoaded(FGameplayTag SlotTag);
 
-	/** Get the owner's skeletal mesh for socket attachment */
-	USkeletalMeshComponent* GetOwnerMesh() const;
+	/** Create/attach the slot's visual component from its loaded mesh and link its anim layer */
+	void AttachLoadedVisual(FGameplayTag SlotTag);
+
+	/** Issue one streamable request for every slot queued during the current replication update */
+	void FlushReplicatedVisualLoads();
+
+	/** Batch load finished — attach, in one pass, every slot whose MeshLoadHandle is still BatchHandle */
+	void OnReplicatedVisualsLoaded(TArray<FGameplayTag> SlotTags, TWeakPtr<FStreamableHandle> BatchHandle);
+
+	/** Async load priority for this owner, scaled by distance to the local viewer */
+	TAsyncLoadPriority GetVisualLoadPriority() const;
+
+	/** Drop a slot's load handle, cancelling it only if no other slot shares it (batched loads) */
+	void ReleaseMeshLoadHandle(FEquipmentSlot& Slot);
+
+	/** Slots whose visuals changed in the replication update being applied */
+	TArray<FGameplayTag> PendingReplicatedVisualSlots;
+
+	/** Take a registered component from the pool (or create one) and attach it to Socket on the owner mesh */
+	UStaticMeshComponent* AcquireStaticMeshComponent(USkeletalMeshComponent* OwnerMesh, FName Socket);
+	USkeletalMeshComponent* AcquireSkeletalMeshComponent(USkeletalMeshComponent* OwnerMesh, FName Socket);
+
+	/** Whether a slot shows its visual at the current VisualLOD */
+	bool ShouldSlotHaveVisual(const FEquipmentSlot& Slot) const;
+
+	/** Current visual detail tier */
+	EEquipmentVisualLOD VisualLOD = EEquipmentVisualLOD::Full;
+
+	/** Point a skeletal equipment component at its pose source per the slot's EEquipmentPoseMode */
+	void ApplyPoseMode(USkeletalMeshComponent* SkelComp, USkeletalMeshComponent* OwnerMesh, FGameplayTag SlotTag) const;
+
+	/** Visual settings for a slot, or nullptr for defaults */
+	const FEquipmentSlotVisualSettings* FindSlotVisualSettings(FGameplayTag SlotTag) const;
+
+	// -----------------------------------------------------------------------
+	// Anim Layers
+	// -----------------------------------------------------------------------
+
+	/** Move a slot's anim layer reference to LayerClass (nullptr releases it) */
+	void SetSlotAnimLayer(FEquipmentSlot& Slot, TSubclassOf<UAnimInstance> LayerClass);
+
+	/** Link/unlink on the owner mesh whatever changed since the last flush — one pass per frame */
+	void FlushAnimLayers();
+
+	/** Anim layer class → number of slots using it */
+	UPROPERTY(Transient)
+	TMap<TSubclassOf<UAnimInstance>, int32> AnimLayerRefCounts;
+
+	/** Layer classes currently linked on the owner mesh */
+	UPROPERTY(Transient)
+	TArray<TSubclassOf<UAnimInstance>> LinkedAnimLayers;
+
+	bool bAnimLayerFlushScheduled = false;
+
+	/** Rebuild the merged mesh on the next tick (bMergeSkeletalEquipment) */
+	void ScheduleMeshMerge();
+
+	/** Merge the body and every loaded skeletal equipment mesh onto the owner mesh. Waits while loads are pending. */
+	void RebuildMergedMesh();
+
+	/** Owner mesh asset before any merge — the first source of every merge */
+	UPROPERTY(Transient)
+	TObjectPtr<USkeletalMesh> UnmergedBodyMesh;
+
+	bool bMeshMergeScheduled = false;
+
+	/** Hide a slot's visual component and return it to the pool, or destroy it if the pool is full */
+	void ReleaseVisualComponent(USceneComponent* Component);
+
+	/** Destroy pooled components beyond the given count per mesh type */
+	void TrimVisualComponentPool(int32 MaxStatic, int32 MaxSkeletal);
+
+	/** Hidden, registered components waiting for reuse */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UStaticMeshComponent>> PooledStaticMeshComponents;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<USkeletalMeshComponent>> PooledSkeletalMeshComponents;
 
 	// -----------------------------------------------------------------------
 	// Helpers
 	// -----------------------------------------------------------------------
 
 	UItemDatabaseSubsystem* GetItemDatabase() const;
-	UItemFragment_Equipment* GetEquipmentFragment(const FItemInstance& Item) const;
+
+	/** Inventory on the owning actor — the source the GUID-only RPCs resolve items from */
+	UInventoryComponent* GetOwnerInventory() const;
+
+	/** Resolve an item's definition and equipment fragment — one database lookup */
+	FEquipmentResolvedItem ResolveItem(const FItemInstance& Item) const;
 
 	UPROPERTY()
 	mutable TObjectPtr<UItemDatabaseSubsystem> CachedItemDatabase;
+
+	mutable TWeakObjectPtr<UInventoryComponent> CachedOwnerInventory;
+
+	/** Found bindings only — a missing component is searched for again on the next call */
+	mutable TWeakObjectPtr<USkeletalMeshComponent> CachedOwnerMesh;
+	mutable TWeakObjectPtr<UActorComponent> CachedAbilitySystem;
+
+	/** Class CachedAbilitySystem was looked up for */
+	mutable TWeakObjectPtr<UClass> CachedAbilitySystemClass;
+
+	/** Possession can swap the owner's components (e.g. a controller-added ASC) — drop the cached bindings */
+	UFUNCTION()
+	void HandleOwnerControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+	/** SlotTag → index into EquipmentSlots.Slots */
+	TMap<FGameplayTag, int32> SlotIndexByTag;
+
+	/** SlotTag → index into AvailableSlots */
+	TMap<FGameplayTag, int32> DefinitionIndexByTag;
+
+	/** SlotTag → index into SlotVisualSettings */
+	TMap<FGameplayTag, int32> VisualSettingsIndexByTag;
+
+	/** Auto-slotting candidates for one preferred slot tag */
+	struct FSlotCandidates
+	{
+		/** Slots whose tag equals the preferred tag, then slots under it — each group in slot order */
+		TArray<int32> Ordered;
+
+		/** First matching slot in slot order — swap target when every candidate is occupied */
+		int32 Fallback = INDEX_NONE;
+	};
+
+	/** Preferred slot tag (each slot tag and all of its parents) → candidate slot indices */
+	TMap<FGameplayTag, FSlotCandidates> SlotCandidatesByTag;
+
+	/** Occupied bit per runtime slot — kept in sync with FEquipmentSlot::bIsOccupied */
+	TBitArray<> OccupancyMask;
+
+	/** A replication update added or removed slots — the index is rebuilt once when the update completes */
+	bool bSlotLayoutDirty = false;
+
+	/** Flag a slot (and its proxy visual record) for delta replication and mark the push-model properties dirty */
+	void MarkSlotDirty(FEquipmentSlot& Slot);
+
+	/** Copy a slot's bIsOccupied into OccupancyMask */
+	void UpdateOccupancyBit(FGameplayTag SlotTag);
+
+	/** Nesting depth of BeginChangeBatch/EndChangeBatch */
+	int32 ChangeBatchDepth = 0;
+
+	/** Set when a change happens inside a batch; consumed by EndChangeBatch */
+	bool bChangedDuringBatch = false;
+
+	/** GAS work deferred by the current batch */
+	TArray<FPendingGASChange> PendingGASChanges;
+
+	/** Slots changed since the last OnEquipmentSlotsChanged broadcast */
+	TBitArray<> PendingChangedSlots;
+
+	/** Set while a FlushSlotChanges is scheduled for the next tick */
+	bool bSlotChangeFlushScheduled = false;
 };
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EquipmentMeshMergeSubsystem.generated.h"
+
+class USkeletalMesh;
+class USkeleton;
+
+/**
+ * Cache of merged equipment skeletal meshes, keyed by loadout hash.
+ * Characters with identical gear (same body + same skeletal pieces in the same order)
+ * share one merged asset instead of merging again. Entries are weak — a merged mesh
+ * lives as long as some component still uses it.
+ */
+UCLASS()
+class EQUIPMENTPLUGIN_API UEquipmentMeshMergeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Merged mesh for the given source meshes (body first), merging on a cache miss.
+	 * Returns nullptr if the merge fails.
+	 */
+	USkeletalMesh* FindOrMerge(const TArray<USkeletalMesh*>& SourceMeshes, USkeleton* Skeleton);
+
+	/** Loadout hash of an ordered source mesh list */
+	static uint32 HashSourceMeshes(const TArray<USkeletalMesh*>& SourceMeshes);
+
+private:
+	struct FMergedMeshEntry
+	{
+		/** Exact sources — guards against hash collisions */
+		TArray<TWeakObjectPtr<USkeletalMesh>> SourceMeshes;
+		TWeakObjectPtr<USkeletalMesh> MergedMesh;
+
+		bool Matches(const TArray<USkeletalMesh*>& InSourceMeshes) const;
+	};
+
+	/** Remove every entry whose merged mesh or any source mesh has been collected */
+	void PruneExpiredEntries();
+
+	TMultiMap<uint32, FMergedMeshEntry> MergedMeshes;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "EquipmentVisualSubsystem.generated.h"
+
+class APlayerController;
+class UEquipmentManagerComponent;
+
+/**
+ * Time-sliced visual attachment for every equipment manager in the world.
+ * Mesh loads that finish are queued here instead of creating and registering components
+ * in the load callback; Tick drains the queue under a per-frame budget
+ * (Equipment.VisualAttachBudgetMs), local player first, then on-screen and nearby actors.
+ * A mass NPC spawn is spread over several frames instead of hitching one.
+ *
+ * Also assigns each registered manager's EEquipmentVisualLOD from its distance to the local
+ * view (Equipment.VisualLOD.* console variables, with hysteresis at each boundary); the locally
+ * controlled pawn always stays Full. Dedicated servers have no local view and never register.
+ */
+UCLASS()
+class EQUIPMENTPLUGIN_API UEquipmentVisualSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Queue a slot whose mesh has loaded for attachment (no-op if already queued) */
+	void QueueAttachment(UEquipmentManagerComponent* Manager, FGameplayTag SlotTag);
+
+	/** Number of attachments waiting for budget */
+	int32 GetNumPendingAttachments() const { return PendingAttachments.Num(); }
+
+	/** Have the subsystem drive a manager's visual LOD tier (bAutomaticVisualLOD managers, from BeginPlay) */
+	void RegisterForVisualLOD(UEquipmentManagerComponent* Manager);
+	void UnregisterForVisualLOD(UEquipmentManagerComponent* Manager);
+
+	/** First locally controlled player controller in World, or null (e.g. on a dedicated server) */
+	static const APlayerController* FindLocalPlayerController(const UWorld* World);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FPendingAttachment
+	{
+		TWeakObjectPtr<UEquipmentManagerComponent> Manager;
+		FGameplayTag SlotTag;
+
+		/** Lower attaches first — recomputed every tick as actors and the view move */
+		float Priority = 0.f;
+	};
+
+	/** Priority score for a manager's owner relative to the local view */
+	static float ComputePriority(const UEquipmentManagerComponent* Manager, const FVector& ViewLocation, bool bHasView);
+
+	/** Re-tier every registered manager from the current view */
+	void UpdateVisualLODs(const FVector& ViewLocation, bool bHasView);
+
+	TArray<FPendingAttachment> PendingAttachments;
+
+	TArray<TWeakObjectPtr<UEquipmentManagerComponent>> LODManagers;
+
+	/** Seconds until the next UpdateVisualLODs */
+	float TimeUntilLODUpdate = 0.f;
+};
@@ -5,17 +5,129 @@
 #include "Types/CGFItemTypes.h"
 #include "Types/CGFCommonEnums.h"
 #include "Engine/StreamableManager.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "EquipmentSystemTypes.generated.h"
 
+class UAnimInstance;
+class UEquipmentManagerComponent;
+class UItemDefinition;
+class UItemFragment_Equipment;
+struct FEquipmentSlotContainer;
+struct FEquipmentVisualSlotContainer;
+
+/**
+ * Item definition and equipment fragment resolved from the item database.
+ * Resolved once per equip and cached on the runtime slot, so visuals and GAS
+ * don't repeat the lookup.
+ */
+USTRUCT()
+struct EQUIPMENTPLUGIN_API FEquipmentResolvedItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UItemDefinition> Definition;
+
+	UPROPERTY()
+	TObjectPtr<UItemFragment_Equipment> EquipmentFragment;
+
+	/** True if the item is equippable (has an equipment fragment) */
+	bool IsValid() const { return EquipmentFragment != nullptr; }
+
+	void Reset()
+	{
+		Definition = nullptr;
+		EquipmentFragment = nullptr;
+	}
+};
+
+/** How a skeletal equipment mesh gets its pose */
+UENUM(BlueprintType)
+enum class EEquipmentPoseMode : uint8
+{
+	/** Evaluates its own animation (default — needed for meshes with their own anim, e.g. cloth capes with an anim BP) */
+	Independent,
+
+	/** Follows the owner mesh via SetLeaderPoseComponent — no animation evaluation of its own. Requires the owner's skeleton. Attached to the owner mesh root, ignoring AttachSocket. */
+	LeaderPose,
+
+	/** Runs CopyPoseAnimClass (a Copy Pose From Mesh anim graph) — for meshes on a compatible but different skeleton */
+	CopyPose
+};
+
+/** Equipment visual detail tier, driven by the owner's significance (distance to the local view) */
+UENUM(BlueprintType)
+enum class EEquipmentVisualLOD : uint8
+{
+	/** Every piece, with anim layers */
+	Full,
+
+	/** Only slots flagged bKeepAtReducedLOD (e.g. weapons) plus the merged mesh in merge mode; no anim layers */
+	Reduced,
+
+	/** No equipment components at all */
+	None
+};
+
+/**
+ * Per-slot visual options, keyed by slot tag. Slots without an entry use the defaults.
+ */
+USTRUCT(BlueprintType)
+struct EQUIPMENTPLUGIN_API FEquipmentSlotVisualSettings
+{
+	GENERATED_BODY()
+
+	/** Slot these settings apply to (matches FEquipmentSlotDefinition::SlotTag) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FGameplayTag SlotTag;
+
+	/** Pose source for skeletal equipment in this slot (static meshes ignore it) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	EEquipmentPoseMode PoseMode = EEquipmentPoseMode::Independent;
+
+	/** Anim class for CopyPose — its graph should copy from the attach parent */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (EditCondition = "PoseMode == EEquipmentPoseMode::CopyPose"))
+	TSubclassOf<UAnimInstance> CopyPoseAnimClass;
+
+	/** Keep this slot's visual at EEquipmentVisualLOD::Reduced (weapons, silhouette-defining pieces) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bKeepAtReducedLOD = false;
+};
+
+/**
+ * One entry of a loadout passed to UEquipmentManagerComponent::TryApplyLoadout.
+ * An invalid Item clears the slot.
+ */
+USTRUCT(BlueprintType)
+struct EQUIPMENTPLUGIN_API FEquipmentLoadoutEntry
+{
+	GENERATED_BODY()
+
+	/** Slot to fill or clear */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FGameplayTag SlotTag;
+
+	/** Item to equip — leave invalid to unequip the slot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	FItemInstance Item;
+};
+
 /**
  * Runtime equipment slot — holds the currently equipped item and visual state.
- * Created from FEquipmentSlotDefinition during BeginPlay.
+ * Created from FEquipmentSlotDefinition during BeginPlay on the server.
+ * Replicated as a fast array item so only changed slots are sent and processed.
+ * NetSerialize sends only SlotIndex, an occupancy bit and the item; the static
+ * config fields are rebuilt on receipt from AvailableSlots[SlotIndex].
  */
 USTRUCT(BlueprintType)
-struct EQUIPMENTPLUGIN_API FEquipmentSlot
+struct EQUIPMENTPLUGIN_API FEquipmentSlot : public FFastArraySerializerItem
 {
 	GENERATED_BODY()
 
+	/** Index of this slot's definition in the owning component's AvailableSlots */
+	UPROPERTY(BlueprintReadOnly)
+	uint8 SlotIndex = 0;
+
 	/** Tag identifying this slot (matches FEquipmentSlotDefinition::SlotTag) */
 	UPROPERTY(BlueprintReadOnly)
 	FGameplayTag SlotTag;
@@ -46,4 +158,147 @@ struct EQUIPMENTPLUGIN_API FEquipmentSlot
 
 	/** Async mesh load handle */
 	TSharedPtr<FStreamableHandle> MeshLoadHandle;
+
+	/** Anim layer class this slot holds a reference on in the owner's layer ref counts */
+	UPROPERTY(NotReplicated)
+	TSubclassOf<UAnimInstance> LinkedAnimLayerClass;
+
+	/** Definition/fragment of EquippedItem — resolved on equip (or on replication for clients) */
+	UPROPERTY(NotReplicated)
+	FEquipmentResolvedItem ResolvedItem;
+
+	// -----------------------------------------------------------------------
+	// Fast array callbacks (clients only)
+	// -----------------------------------------------------------------------
+
+	void PreReplicatedRemove(const FEquipmentSlotContainer& InArraySerializer);
+	void PostReplicatedAdd(const FEquipmentSlotContainer& InArraySerializer);
+	void PostReplicatedChange(const FEquipmentSlotContainer& InArraySerializer);
+
+	/** Compact replication: SlotIndex + occupancy bit + item payload */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FEquipmentSlot> : public TStructOpsTypeTraitsBase2<FEquipmentSlot>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/**
+ * Delta-replicated container for runtime equipment slots.
+ * Changed slots are marked dirty individually (MarkItemDirty), so an equip
+ * sends one slot instead of the whole loadout.
+ */
+USTRUCT(BlueprintType)
+struct EQUIPMENTPLUGIN_API FEquipmentSlotContainer : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FEquipmentSlotContainer() = default;
+
+	explicit FEquipmentSlotContainer(UEquipmentManagerComponent* InOwner)
+		: Owner(InOwner)
+	{
+	}
+
+	/** Runtime slots, in AvailableSlots order on the server */
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FEquipmentSlot> Slots;
+
+	/** Component that receives per-slot replication callbacks */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UEquipmentManagerComponent> Owner;
+
+	// -----------------------------------------------------------------------
+	// FFastArraySerializer
+	// -----------------------------------------------------------------------
+
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FEquipmentSlot, FEquipmentSlotContainer>(
+			Slots, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FEquipmentSlotContainer> : public TStructOpsTypeTraitsBase2<FEquipmentSlotContainer>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * Compact per-slot record replicated to simulated proxies (everyone but the owner).
+ * Carries only what is needed to build visuals — the owner receives the full
+ * FEquipmentSlot (instance GUID, stack count, payload) instead.
+ */
+USTRUCT()
+struct EQUIPMENTPLUGIN_API FEquipmentVisualSlot : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Index into the owning component's AvailableSlots */
+	UPROPERTY()
+	uint8 SlotIndex = 0;
+
+	/** Definition of the equipped item — invalid when the slot is empty */
+	UPROPERTY()
+	FPrimaryAssetId ItemDefinitionId;
+
+	// -----------------------------------------------------------------------
+	// Fast array callbacks (simulated proxies only)
+	// -----------------------------------------------------------------------
+
+	void PostReplicatedAdd(const FEquipmentVisualSlotContainer& InArraySerializer);
+	void PostReplicatedChange(const FEquipmentVisualSlotContainer& InArraySerializer);
+};
+
+/** Delta-replicated container of visual records, one per slot */
+USTRUCT()
+struct EQUIPMENTPLUGIN_API FEquipmentVisualSlotContainer : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FEquipmentVisualSlotContainer() = default;
+
+	explicit FEquipmentVisualSlotContainer(UEquipmentManagerComponent* InOwner)
+		: Owner(InOwner)
+	{
+	}
+
+	UPROPERTY()
+	TArray<FEquipmentVisualSlot> Items;
+
+	/** Component that receives per-record replication callbacks */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UEquipmentManagerComponent> Owner;
+
+	// -----------------------------------------------------------------------
+	// FFastArraySerializer
+	// -----------------------------------------------------------------------
+
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FEquipmentVisualSlot, FEquipmentVisualSlotContainer>(
+			Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FEquipmentVisualSlotContainer> : public TStructOpsTypeTraitsBase2<FEquipmentVisualSlotContainer>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
 };
@@ -80,8 +80,11 @@ protected:
 private:
 	void BuildWidgetTree();
 
-	UFUNCTION()
-	void HandleEquipmentChanged();
+	/** Coalesced change event — refreshes only when this widget's slot is in the mask */
+	void HandleEquipmentSlotsChanged(const TBitArray<>& ChangedSlots);
+
+	/** Stop listening to BoundEquipmentManager */
+	void UnbindEquipmentManager();
 
 	UPROPERTY()
 	TObjectPtr<USizeBox> RootSizeBox;
@@ -98,6 +101,8 @@ private:
 	UPROPERTY()
 	TObjectPtr<UEquipmentManagerComponent> BoundEquipmentManager;
 
+	FDelegateHandle SlotsChangedHandle;
+
 	FGameplayTag SlotTag;
 
 	bool bIsHeld = false;